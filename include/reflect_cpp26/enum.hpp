@@ -23,6 +23,7 @@
 #ifndef REFLECT_CPP26_ENUM_HPP
 #define REFLECT_CPP26_ENUM_HPP
 
+#include <reflect_cpp26/enum/enum_bitset.hpp>
 #include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
 #include <reflect_cpp26/enum/enum_cast.hpp>
 #include <reflect_cpp26/enum/enum_comparison_operators.hpp>
@@ -37,6 +38,7 @@
 #include <reflect_cpp26/enum/enum_hash.hpp>
 #include <reflect_cpp26/enum/enum_index.hpp>
 #include <reflect_cpp26/enum/enum_json.hpp>
+#include <reflect_cpp26/enum/enum_map.hpp>
 #include <reflect_cpp26/enum/enum_meta_entries.hpp>
 #include <reflect_cpp26/enum/enum_name.hpp>
 #include <reflect_cpp26/enum/enum_names.hpp>
@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_ENUM_ENUM_BITSET_HPP
+#define REFLECT_CPP26_ENUM_ENUM_BITSET_HPP
+
+#include <bitset>
+#include <initializer_list>
+#include <iterator>
+#include <reflect_cpp26/enum/impl/enum_unique_entries.hpp>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class E, size_t N>
+class enum_bitset_iterator {
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using value_type = E;
+  using reference = E;
+  using difference_type = ptrdiff_t;
+
+  constexpr enum_bitset_iterator() = default;
+
+  constexpr enum_bitset_iterator(const std::bitset<N>* bits,
+                                 const enum_index_uint_t<E>* cur,
+                                 const enum_index_uint_t<E>* end)
+      : bits_(bits), cur_(cur), end_(end) {
+    skip_unset();
+  }
+
+  constexpr auto operator*() const -> E {
+    return enum_unique_values_array_v<E>[*cur_];
+  }
+
+  constexpr auto operator++() -> enum_bitset_iterator& {
+    cur_ += 1;
+    skip_unset();
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> enum_bitset_iterator {
+    auto res = *this;
+    ++*this;
+    return res;
+  }
+
+  constexpr bool operator==(const enum_bitset_iterator& rhs) const {
+    return cur_ == rhs.cur_;
+  }
+
+private:
+  constexpr void skip_unset() {
+    for (; cur_ != end_ && !bits_->test(*cur_); ++cur_) {}
+  }
+
+  const std::bitset<N>* bits_ = nullptr;
+  const enum_index_uint_t<E>* cur_ = nullptr;
+  const enum_index_uint_t<E>* end_ = nullptr;
+};
+}  // namespace impl
+
+/**
+ * Fixed-size set of distinct values of enum type E, with one bit per enum_unique_index.
+ * Values not defined in E are never members. Iteration visits members in given order.
+ */
+template <enum_type E, enum_entry_order Order = enum_entry_order::original>
+class enum_bitset {
+  static_assert(std::is_same_v<E, std::remove_cv_t<E>>, "cv-qualified enum type is not allowed.");
+  static constexpr auto N = enum_unique_count_v<E>;
+
+public:
+  using value_type = E;
+  using iterator = impl::enum_bitset_iterator<E, N>;
+  using const_iterator = iterator;
+
+  constexpr enum_bitset() = default;
+
+  constexpr enum_bitset(std::initializer_list<E> values) {
+    for (auto v : values) {
+      set(v);
+    }
+  }
+
+  static constexpr auto size() -> size_t {
+    return N;
+  }
+
+  constexpr bool test(E value) const {
+    auto index = enum_unique_index(value);
+    return index != npos && bits_.test(index);
+  }
+
+  constexpr bool contains(E value) const {
+    return test(value);
+  }
+
+  // No-op if value is not defined in E.
+  constexpr auto set(E value, bool flag = true) -> enum_bitset& {
+    if (auto index = enum_unique_index(value); index != npos) {
+      bits_.set(index, flag);
+    }
+    return *this;
+  }
+
+  constexpr auto set() -> enum_bitset& {
+    bits_.set();
+    return *this;
+  }
+
+  constexpr auto reset(E value) -> enum_bitset& {
+    return set(value, false);
+  }
+
+  constexpr auto reset() -> enum_bitset& {
+    bits_.reset();
+    return *this;
+  }
+
+  // No-op if value is not defined in E.
+  constexpr auto flip(E value) -> enum_bitset& {
+    if (auto index = enum_unique_index(value); index != npos) {
+      bits_.flip(index);
+    }
+    return *this;
+  }
+
+  constexpr auto flip() -> enum_bitset& {
+    bits_.flip();
+    return *this;
+  }
+
+  constexpr auto count() const -> size_t {
+    return bits_.count();
+  }
+
+  constexpr bool all() const {
+    return bits_.all();
+  }
+
+  constexpr bool any() const {
+    return bits_.any();
+  }
+
+  constexpr bool none() const {
+    return bits_.none();
+  }
+
+  constexpr auto bits() const -> const std::bitset<N>& {
+    return bits_;
+  }
+
+  constexpr auto operator&=(const enum_bitset& rhs) -> enum_bitset& {
+    bits_ &= rhs.bits_;
+    return *this;
+  }
+
+  constexpr auto operator|=(const enum_bitset& rhs) -> enum_bitset& {
+    bits_ |= rhs.bits_;
+    return *this;
+  }
+
+  constexpr auto operator^=(const enum_bitset& rhs) -> enum_bitset& {
+    bits_ ^= rhs.bits_;
+    return *this;
+  }
+
+  constexpr auto operator~() const -> enum_bitset {
+    auto res = *this;
+    res.bits_.flip();
+    return res;
+  }
+
+  friend constexpr auto operator&(enum_bitset lhs, const enum_bitset& rhs) -> enum_bitset {
+    return lhs &= rhs;
+  }
+
+  friend constexpr auto operator|(enum_bitset lhs, const enum_bitset& rhs) -> enum_bitset {
+    return lhs |= rhs;
+  }
+
+  friend constexpr auto operator^(enum_bitset lhs, const enum_bitset& rhs) -> enum_bitset {
+    return lhs ^= rhs;
+  }
+
+  constexpr bool operator==(const enum_bitset& rhs) const = default;
+
+  constexpr auto begin() const -> iterator {
+    return {&bits_, order_begin(), order_begin() + N};
+  }
+
+  constexpr auto end() const -> iterator {
+    return {&bits_, order_begin() + N, order_begin() + N};
+  }
+
+private:
+  static constexpr auto order_begin() -> const impl::enum_index_uint_t<E>* {
+    return impl::enum_unique_index_order_array_v<E, Order>.data();
+  }
+
+  std::bitset<N> bits_;
+};
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_ENUM_ENUM_BITSET_HPP
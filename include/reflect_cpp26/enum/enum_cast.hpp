@@ -23,10 +23,12 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_CAST_HPP
 #define REFLECT_CPP26_ENUM_ENUM_CAST_HPP
 
+#include <algorithm>
 #include <reflect_cpp26/enum/enum_contains.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/tags.hpp>
 #include <reflect_cpp26/utils/utility.hpp>
+#include <span>
 
 namespace reflect_cpp26 {
 template <enum_type E>
@@ -60,8 +62,55 @@ public:
   }
 };
 
+namespace impl {
+template <class E, class Input, class CastFunc>
+constexpr auto enum_cast_many_impl(std::span<const Input> inputs,
+                                   std::span<std::optional<E>> outputs,
+                                   CastFunc cast) -> size_t {
+  auto n = std::min(inputs.size(), outputs.size());
+  auto n_valid = 0zU;
+  for (auto i = 0zU; i < n; i++) {
+    outputs[i] = cast(inputs[i]);
+    n_valid += outputs[i].has_value();
+  }
+  return n_valid;
+}
+}  // namespace impl
+
+/**
+ * Batch conversion: outputs[i] = enum_cast<E>(inputs[i]) for each
+ * i < min(inputs.size(), outputs.size()). Returns the number of successful conversions.
+ */
+template <enum_type E>
+struct enum_cast_many_t {
+  static constexpr auto operator()(std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs) -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [](std::string_view str) {
+      return enum_cast_t<E>::operator()(str);
+    });
+  }
+
+  static constexpr auto operator()(ascii_case_insensitive_tag_t,
+                                   std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs) -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [](std::string_view str) {
+      return enum_cast_t<E>::operator()(ascii_case_insensitive, str);
+    });
+  }
+
+  static constexpr auto operator()(std::span<const std::underlying_type_t<E>> inputs,
+                                   std::span<std::optional<E>> outputs) -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [](std::underlying_type_t<E> value) {
+      return enum_cast_t<E>::operator()(value);
+    });
+  }
+};
+
 template <enum_type E>
 constexpr auto enum_cast = enum_cast_t<std::remove_cv_t<E>>{};
+
+template <enum_type E>
+constexpr auto enum_cast_many = enum_cast_many_t<std::remove_cv_t<E>>{};
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_ENUM_ENUM_CAST_HPP
@@ -24,6 +24,7 @@
 #define REFLECT_CPP26_ENUM_ENUM_CONTAINS_HPP
 
 #include <reflect_cpp26/enum/impl/enum_maps.hpp>
+#include <reflect_cpp26/enum/impl/enum_membership.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/functional.hpp>
 #include <reflect_cpp26/utils/tags.hpp>
@@ -38,8 +39,7 @@ private:
 
 public:
   static constexpr bool operator()(ENoCV value) {
-    auto key = impl::promoted(value);
-    return impl::enum_name_map_v<E>.find(key).has_value();
+    return impl::enum_membership_v<ENoCV>.contains(impl::promoted(value));
   }
 
   static constexpr bool operator()(std::integral auto value) {
@@ -47,7 +47,7 @@ public:
       return false;
     }
     auto value_as_enum = static_cast<ENoCV>(value);
-    return impl::enum_name_map_v<E>.find(impl::promoted(value_as_enum)).has_value();
+    return impl::enum_membership_v<ENoCV>.contains(impl::promoted(value_as_enum));
   }
 
   static constexpr bool operator()(std::string_view str) {
@@ -25,30 +25,29 @@
 
 #include <reflect_cpp26/enum/enum_cast.hpp>
 #include <reflect_cpp26/enum/enum_flags_contains.hpp>
+#include <reflect_cpp26/enum/impl/enum_flags_tokenizer.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/tags.hpp>
+#include <span>
 
 namespace reflect_cpp26 {
 namespace impl {
 template <bool CaseInsensitive, class E, class Delim>
 constexpr auto enum_flags_cast_impl(std::string_view str, Delim delim) -> std::optional<E> {
-  auto underlying = std::underlying_type_t<E>{0};
-  for (auto token : std::views::split(str, delim)) {
-    auto trimmed = ascii_trim(token);
-    if (trimmed.empty()) {
-      continue;
-    }
-    auto opt = [trimmed] constexpr {
-      if constexpr (CaseInsensitive) {
-        return enum_cast<E>(ascii_case_insensitive, trimmed);
-      } else {
-        return enum_cast<E>(trimmed);
-      }
-    }();
-    if (!opt.has_value()) {
-      return std::nullopt;
-    }
-    underlying |= std::to_underlying(*opt);
+  using U = std::underlying_type_t<E>;
+  auto underlying = U{0};
+  auto ok = for_each_enum_flags_token<CaseInsensitive>(
+      str, delim, [&underlying](enum_flags_token token) {
+        const auto& map = enum_from_string_map_ref<E, CaseInsensitive>();
+        auto p = map.find_hashed(token.text, token.hash);
+        if (!p.has_value()) {
+          return false;
+        }
+        underlying |= static_cast<U>(*p);
+        return true;
+      });
+  if (!ok) {
+    return std::nullopt;
   }
   return static_cast<E>(underlying);
 }
@@ -89,8 +88,52 @@ public:
   }
 };
 
+/**
+ * Batch conversion: outputs[i] = enum_flags_cast<E>(inputs[i], delim) for each
+ * i < min(inputs.size(), outputs.size()). Returns the number of successful conversions.
+ */
+template <enum_type E>
+struct enum_flags_cast_many_t {
+  static constexpr auto operator()(std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs,
+                                   char delim = '|') -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [delim](std::string_view str) {
+      return impl::enum_flags_cast_impl<false, E>(str, delim);
+    });
+  }
+
+  static constexpr auto operator()(std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs,
+                                   std::string_view delim) -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [delim](std::string_view str) {
+      return impl::enum_flags_cast_impl<false, E>(str, delim);
+    });
+  }
+
+  static constexpr auto operator()(ascii_case_insensitive_tag_t,
+                                   std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs,
+                                   char delim = '|') -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [delim](std::string_view str) {
+      return impl::enum_flags_cast_impl<true, E>(str, delim);
+    });
+  }
+
+  static constexpr auto operator()(ascii_case_insensitive_tag_t,
+                                   std::span<const std::string_view> inputs,
+                                   std::span<std::optional<E>> outputs,
+                                   std::string_view delim) -> size_t {
+    return impl::enum_cast_many_impl(inputs, outputs, [delim](std::string_view str) {
+      return impl::enum_flags_cast_impl<true, E>(str, delim);
+    });
+  }
+};
+
 template <enum_type E>
 constexpr auto enum_flags_cast = enum_flags_cast_t<std::remove_cv_t<E>>{};
+
+template <enum_type E>
+constexpr auto enum_flags_cast_many = enum_flags_cast_many_t<std::remove_cv_t<E>>{};
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_ENUM_ENUM_FLAGS_CAST_HPP
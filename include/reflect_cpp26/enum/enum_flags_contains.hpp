@@ -25,6 +25,7 @@
 
 #include <reflect_cpp26/enum/enum_contains.hpp>
 #include <reflect_cpp26/enum/impl/enum_flags.hpp>
+#include <reflect_cpp26/enum/impl/enum_flags_tokenizer.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/ctype.hpp>
 #include <reflect_cpp26/utils/functional.hpp>
@@ -84,27 +85,16 @@ constexpr bool enum_flags_contains_impl(impl::unsigned_promoted_t<E> underlying)
 
 template <class E, class Delim>
 constexpr bool enum_flags_contains_impl(std::string_view str, Delim delim) {
-  for (auto token : std::views::split(str, delim)) {
-    auto trimmed = ascii_trim(token);
-    if (!trimmed.empty() && !enum_contains<E>(trimmed)) {
-      return false;
-    }
-  }
-  return true;
+  return for_each_enum_flags_token<false>(str, delim, [](enum_flags_token token) {
+    return enum_from_string_map_v<E>.find_hashed(token.text, token.hash).has_value();
+  });
 }
 
 template <class E, class Delim>
 constexpr bool enum_flags_contains_ci_impl(std::string_view str, Delim delim) {
-  for (auto token : std::views::split(str, delim)) {
-    auto trimmed = ascii_trim(token);
-    if (trimmed.empty()) {
-      continue;
-    }
-    if (!enum_contains<E>(ascii_case_insensitive, trimmed)) {
-      return false;
-    }
-  }
-  return true;
+  return for_each_enum_flags_token<true>(str, delim, [](enum_flags_token token) {
+    return enum_from_ci_string_map_v<E>.find_hashed(token.text, token.hash).has_value();
+  });
 }
 }  // namespace impl
 
@@ -25,6 +25,7 @@
 
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <reflect_cpp26/enum/impl/enum_flags.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/string_builder.hpp>
@@ -177,9 +178,84 @@ constexpr auto irregular_enum_flags_name_to_impl(Iter iter, Sentinel sentinel, E
   return {.status = to_string_status::done, .out = iter};
 }
 
+// Regular enum flags types whose full set is less than this limit have the names of all the
+// valid flag values (with default delimiter '|') precomputed into a single static string pool.
+constexpr auto enum_flags_name_table_limit = 1024zU;
+
+constexpr bool is_default_flags_delim(char delim) {
+  return delim == '|';
+}
+
+constexpr bool is_default_flags_delim(std::string_view delim) {
+  return delim == "|";
+}
+
+template <class E>
+consteval bool enum_flags_has_name_table() {
+  if constexpr (enum_flags_is_regular_v<E>) {
+    return enum_flags_decomposer_v<E>.full_set < enum_flags_name_table_limit;
+  } else {
+    return false;
+  }
+}
+
+template <class E>
+constexpr auto enum_flags_has_name_table_v = enum_flags_has_name_table<E>();
+
+// Name of flag value v is pool[offsets[v], offsets[v + 1]). Empty name indicates invalid flag
+// value except v == 0.
+struct enum_flags_name_table {
+  meta_string_view pool;
+  meta_span<uint32_t> offsets;
+};
+
+template <class E>
+consteval auto make_enum_flags_name_table() -> enum_flags_name_table {
+  auto n = enum_flags_decomposer_v<E>.full_set + 1;
+  auto pool = std::string{};
+  auto offsets = std::vector<uint32_t>{0};
+  offsets.reserve(n + 1);
+  for (auto v = 0zU; v < n; v++) {
+    regular_enum_flags_name_to_impl(
+        std::back_inserter(pool), std::unreachable_sentinel, static_cast<E>(v), '|');
+    offsets.push_back(static_cast<uint32_t>(pool.length()));
+  }
+  return {reflect_cpp26::define_static_string(pool), reflect_cpp26::define_static_array(offsets)};
+}
+
+template <class E>
+constexpr auto enum_flags_name_table_v = make_enum_flags_name_table<E>();
+
+template <class E>
+constexpr auto enum_flags_name_from_table(E flags) -> std::optional<std::string_view> {
+  constexpr const auto& table = enum_flags_name_table_v<E>;
+  auto v = unsigned_promoted(flags);
+  if (v >= table.offsets.size() - 1) {
+    return std::nullopt;
+  }
+  auto begin = table.offsets[v];
+  auto end = table.offsets[v + 1];
+  if (begin == end && v != 0) {
+    return std::nullopt;
+  }
+  return std::string_view{table.pool.data() + begin, end - begin};
+}
+
 template <class Iter, class Sentinel, class E, class Delim>
 constexpr auto enum_flags_name_to_impl(Iter iter, Sentinel sentinel, E flags, Delim delim)
     -> enum_flags_name_to_result<Iter> {
+  if constexpr (enum_flags_has_name_table_v<E>) {
+    if (is_default_flags_delim(delim)) {
+      auto name = enum_flags_name_from_table(flags);
+      if (!name.has_value()) {
+        return {.status = to_string_status::invalid_input, .out = iter};
+      }
+      if (!do_copy_segment(iter, sentinel, *name)) {
+        return {.status = to_string_status::buffer_run_out, .out = iter};
+      }
+      return {.status = to_string_status::done, .out = iter};
+    }
+  }
   if constexpr (enum_flags_is_empty_v<E>) {
     auto status =
         (std::to_underlying(flags) != 0) ? to_string_status::invalid_input : to_string_status::done;
@@ -191,8 +267,24 @@ constexpr auto enum_flags_name_to_impl(Iter iter, Sentinel sentinel, E flags, De
   }
 }
 
+// Upper bound of the length of any flags name of E.
+template <class E>
+constexpr auto enum_flags_name_max_length(size_t delim_length) -> size_t {
+  if constexpr (enum_flags_is_empty_v<E>) {
+    return 0;
+  } else {
+    return enum_flag_names_sum_length_v<E> + delim_length * enum_flags_decomposer_v<E>.units.size();
+  }
+}
+
 template <class E, class Delim>
 constexpr auto enum_flags_name_impl(E flags, Delim delim) -> std::optional<std::string> {
+  if constexpr (enum_flags_has_name_table_v<E>) {
+    if (is_default_flags_delim(delim)) {
+      return enum_flags_name_from_table(flags).transform(
+          [](std::string_view name) { return std::string{name}; });
+    }
+  }
   if constexpr (enum_flags_is_empty_v<E>) {
     if (std::to_underlying(flags) == 0) {
       return std::string{};
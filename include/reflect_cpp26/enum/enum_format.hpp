@@ -23,10 +23,13 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_FORMAT_HPP
 #define REFLECT_CPP26_ENUM_ENUM_FORMAT_HPP
 
+#include <array>
 #include <format>
+#include <iterator>
 #include <reflect_cpp26/enum/enum_flags_name.hpp>
 #include <reflect_cpp26/enum/enum_name.hpp>
 #include <reflect_cpp26/enum/enum_type_name.hpp>
+#include <string_view>
 
 #if __has_include(<fmt/format.h>)
 #include <fmt/format.h>
@@ -45,6 +48,25 @@ constexpr auto enum_alt_name_to(Iter iter, E value) -> Iter {
       std::to_chars(buffer.begin(), buffer.end(), std::to_underlying(value)).ptr;
   return std::ranges::copy(buffer.begin(), buffer_digits_end, iter).out;
 }
+
+template <class FormatContext>
+auto enum_format_write(std::string_view str, FormatContext& ctx) ->
+    typename FormatContext::iterator {
+  // String formatters of the format libraries write to the underlying buffer in bulk.
+  if constexpr (std::is_same_v<FormatContext, std::format_context>) {
+    return std::formatter<std::string_view>{}.format(str, ctx);
+#if __has_include(<fmt/format.h>)
+  } else if constexpr (std::is_same_v<FormatContext, fmt::format_context>) {
+    return fmt::formatter<fmt::string_view>{}.format(fmt::string_view{str.data(), str.size()},
+                                                     ctx);
+#endif
+  } else {
+    return std::ranges::copy(str, ctx.out()).out;
+  }
+}
+
+// Flag names not longer than this are composed on stack first and then written in bulk.
+constexpr auto enum_format_buffer_size = 256zU;
 }  // namespace impl
 
 /**
@@ -53,7 +75,8 @@ constexpr auto enum_alt_name_to(Iter iter, E value) -> Iter {
  */
 template <class FormatError>
 struct enum_common_formatter {
-  std::optional<std::string> custom_delim;
+  // Refers to the format string, which outlives the formatter.
+  std::string_view delim = "|";
   bool as_flags = false;
 
   template <class ParseContext>
@@ -78,32 +101,38 @@ struct enum_common_formatter {
       throw FormatError("Incomplete format args for enum types.");
     }
     if (head != it) {
-      custom_delim = std::string{head, it};
+      delim = std::string_view{head, it};
     }
     return it;
   }
 
   template <enum_type E, class FormatContext>
   auto format(E value, FormatContext& ctx) const -> typename FormatContext::iterator {
-    using iterator_type = typename FormatContext::iterator;
     auto dest = ctx.out();
     if (as_flags) {
-      auto do_output = [value, dest](auto delim) {
-        auto [status, out] = enum_flags_name_to(dest, std::unreachable_sentinel, value, delim);
-        if (to_string_status::done != status) {
-          // Expects status == to_string_status::invalid_input, buffer unchanged
-          return impl::enum_alt_name_to(dest, value);
-        } else {
-          return out;
+      if constexpr (impl::enum_flags_has_name_table_v<E>) {
+        if (impl::is_default_flags_delim(delim)) {
+          auto name = impl::enum_flags_name_from_table(value);
+          return name ? impl::enum_format_write(*name, ctx) : impl::enum_alt_name_to(dest, value);
         }
-      };
-      return custom_delim.has_value() ? do_output(*custom_delim) : do_output('|');
+      }
+      auto buffer = std::array<char, impl::enum_format_buffer_size>{};
+      auto [status, out] =
+          impl::enum_flags_name_to_impl(buffer.data(), buffer.data() + buffer.size(), value, delim);
+      if (to_string_status::done == status) {
+        return impl::enum_format_write(std::string_view{buffer.data(), out}, ctx);
+      }
+      if (to_string_status::invalid_input == status) {
+        return impl::enum_alt_name_to(dest, value);
+      }
+      // Expects status == to_string_status::buffer_run_out: too long to fit in stack buffer
+      return impl::enum_flags_name_to_impl(dest, std::unreachable_sentinel, value, delim).out;
     } else {
       auto name = enum_name(value);
       if (name.empty()) {
         return impl::enum_alt_name_to(dest, value);
       }
-      return std::ranges::copy(name, dest).out;
+      return impl::enum_format_write(name, ctx);
     }
   }
 };
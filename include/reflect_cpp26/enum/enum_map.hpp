@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_ENUM_ENUM_MAP_HPP
+#define REFLECT_CPP26_ENUM_ENUM_MAP_HPP
+
+#include <array>
+#include <iterator>
+#include <optional>
+#include <reflect_cpp26/enum/impl/enum_unique_entries.hpp>
+#include <span>
+#include <utility>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class E, class V, enum_entry_order Order, bool Const>
+class enum_map_iterator {
+  using mapped_reference = std::conditional_t<Const, const V&, V&>;
+  using storage_pointer = std::conditional_t<Const, const V*, V*>;
+
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using value_type = std::pair<E, mapped_reference>;
+  using reference = value_type;
+  using difference_type = ptrdiff_t;
+
+  constexpr enum_map_iterator() = default;
+
+  constexpr enum_map_iterator(storage_pointer values, const enum_index_uint_t<E>* cur)
+      : values_(values), cur_(cur) {}
+
+  constexpr enum_map_iterator(const enum_map_iterator<E, V, Order, false>& other)
+    requires Const
+      : values_(other.values_), cur_(other.cur_) {}
+
+  constexpr auto operator*() const -> reference {
+    return {enum_unique_values_array_v<E>[*cur_], values_[*cur_]};
+  }
+
+  constexpr auto operator++() -> enum_map_iterator& {
+    cur_ += 1;
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> enum_map_iterator {
+    auto res = *this;
+    cur_ += 1;
+    return res;
+  }
+
+  constexpr bool operator==(const enum_map_iterator& rhs) const {
+    return cur_ == rhs.cur_;
+  }
+
+private:
+  friend class enum_map_iterator<E, V, Order, true>;
+
+  storage_pointer values_ = nullptr;
+  const enum_index_uint_t<E>* cur_ = nullptr;
+};
+}  // namespace impl
+
+/**
+ * Fixed-capacity associative container from every distinct value of enum type E to V.
+ * Values are stored in a plain array indexed by enum_unique_index(key).
+ * Iteration visits each distinct value once in given order.
+ */
+template <enum_type E, class V, enum_entry_order Order = enum_entry_order::original>
+class enum_map {
+  static_assert(std::is_same_v<E, std::remove_cv_t<E>>, "cv-qualified enum type is not allowed.");
+  static constexpr auto N = enum_unique_count_v<E>;
+
+public:
+  using key_type = E;
+  using mapped_type = V;
+  using iterator = impl::enum_map_iterator<E, V, Order, false>;
+  using const_iterator = impl::enum_map_iterator<E, V, Order, true>;
+
+  constexpr enum_map() = default;
+
+  constexpr explicit enum_map(const V& init_value) {
+    values_.fill(init_value);
+  }
+
+  static constexpr auto size() -> size_t {
+    return N;
+  }
+
+  static constexpr bool contains(E key) {
+    return enum_unique_index(key) != npos;
+  }
+
+  constexpr auto find(E key) -> std::optional<V&> {
+    auto index = enum_unique_index(key);
+    if (index == npos) {
+      return std::nullopt;
+    }
+    return values_[index];
+  }
+
+  constexpr auto find(E key) const -> std::optional<const V&> {
+    auto index = enum_unique_index(key);
+    if (index == npos) {
+      return std::nullopt;
+    }
+    return values_[index];
+  }
+
+  // Precondition: key is defined in E.
+  constexpr auto operator[](E key) -> V& {
+    auto index = enum_unique_index(key);
+    if (index == npos) {
+      REFLECT_CPP26_UNREACHABLE("Key not defined in enum type.");
+    }
+    return values_[index];
+  }
+
+  // Precondition: key is defined in E.
+  constexpr auto operator[](E key) const -> const V& {
+    auto index = enum_unique_index(key);
+    if (index == npos) {
+      REFLECT_CPP26_UNREACHABLE("Key not defined in enum type.");
+    }
+    return values_[index];
+  }
+
+  // Underlying storage, indexed by enum_unique_index.
+  constexpr auto values() -> std::span<V, N> {
+    return values_;
+  }
+
+  constexpr auto values() const -> std::span<const V, N> {
+    return values_;
+  }
+
+  constexpr void fill(const V& value) {
+    values_.fill(value);
+  }
+
+  constexpr auto begin() -> iterator {
+    return {values_.data(), order_begin()};
+  }
+
+  constexpr auto end() -> iterator {
+    return {values_.data(), order_begin() + N};
+  }
+
+  constexpr auto begin() const -> const_iterator {
+    return {values_.data(), order_begin()};
+  }
+
+  constexpr auto end() const -> const_iterator {
+    return {values_.data(), order_begin() + N};
+  }
+
+  constexpr auto cbegin() const -> const_iterator {
+    return begin();
+  }
+
+  constexpr auto cend() const -> const_iterator {
+    return end();
+  }
+
+  constexpr bool operator==(const enum_map& rhs) const = default;
+
+private:
+  static constexpr auto order_begin() -> const impl::enum_index_uint_t<E>* {
+    return impl::enum_unique_index_order_array_v<E, Order>.data();
+  }
+
+  std::array<V, N> values_{};
+};
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_ENUM_ENUM_MAP_HPP
@@ -23,8 +23,11 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_NAME_HPP
 #define REFLECT_CPP26_ENUM_ENUM_NAME_HPP
 
+#include <algorithm>
+#include <ranges>
 #include <reflect_cpp26/enum/impl/enum_maps.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
+#include <reflect_cpp26/utils/string_builder.hpp>
 
 namespace reflect_cpp26 {
 struct enum_name_t {
@@ -32,7 +35,7 @@ struct enum_name_t {
   static constexpr auto operator()(E value) -> std::string_view {
     auto p = impl::enum_name_map_v<E>.find(impl::promoted(value));
     if (p.has_value()) {
-      return static_cast<std::string_view>(*p);
+      return impl::enum_name_of_slot<E>(*p);
     }
     return {};
   }
@@ -43,14 +46,80 @@ struct enum_name_opt_t {
   static constexpr auto operator()(E value) -> std::optional<std::string_view> {
     auto p = impl::enum_name_map_v<E>.find(impl::promoted(value));
     if (p.has_value()) {
-      return static_cast<std::string_view>(*p);
+      return impl::enum_name_of_slot<E>(*p);
     }
     return std::nullopt;
   }
 };
 
+namespace impl {
+template <class E>
+consteval auto enum_name_max_length() -> size_t {
+  auto res = 0zU;
+  for (auto name : enum_names_v<E>) {
+    res = std::max(res, name.length());
+  }
+  return res;
+}
+
+template <class E>
+constexpr auto enum_name_max_length_v = enum_name_max_length<E>();
+
+template <class Range>
+constexpr auto enum_names_to_impl(string_builder& dest, const Range& values, std::string_view delim)
+    -> size_t {
+  using E = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+  auto n = std::ranges::size(values);
+  if (n == 0) {
+    return 0;
+  }
+  // Reserves once with the upper bound so that no boundary check is needed afterwards.
+  dest.reserve_at_least(n * (enum_name_max_length_v<E> + delim.length()));
+  auto n_valid = 0zU;
+  auto is_first = true;
+  for (auto value : values) {
+    if (!is_first) {
+      dest.append_string_unsafe(delim);
+    }
+    is_first = false;
+    auto p = enum_name_map_v<E>.find(promoted(value));
+    if (p.has_value()) {
+      dest.append_string_unsafe(enum_name_of_slot<E>(*p));
+      n_valid += 1;
+    }
+  }
+  return n_valid;
+}
+}  // namespace impl
+
+template <class Range>
+concept enum_input_range =
+    std::ranges::input_range<Range> && std::ranges::sized_range<Range>
+    && enum_type<std::ranges::range_value_t<Range>>;
+
+/**
+ * Writes names of all the values, separated by delim, to dest. Undefined values are written
+ * as empty strings. Returns the number of values defined in the enum type.
+ */
+struct enum_names_to_t {
+  template <enum_input_range Range>
+  static constexpr auto operator()(string_builder& dest, const Range& values, char delim = ',')
+      -> size_t {
+    return impl::enum_names_to_impl(dest, values, std::string_view{&delim, 1});
+  }
+
+  template <enum_input_range Range>
+  static constexpr auto operator()(string_builder& dest,
+                                   const Range& values,
+                                   std::string_view delim) -> size_t {
+    return impl::enum_names_to_impl(dest, values, delim);
+  }
+};
+
 constexpr auto enum_name = enum_name_t{};
 constexpr auto enum_name_opt = enum_name_opt_t{};
+
+constexpr auto enum_names_to = enum_names_to_t{};
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_ENUM_ENUM_NAME_HPP
@@ -23,25 +23,118 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_NAMES_HPP
 #define REFLECT_CPP26_ENUM_ENUM_NAMES_HPP
 
+#include <algorithm>
+#include <limits>
 #include <reflect_cpp26/enum/enum_meta_entries.hpp>
 #include <reflect_cpp26/utils/concepts.hpp>
 #include <reflect_cpp26/utils/ctype.hpp>
+#include <reflect_cpp26/utils/meta_string_view.hpp>
+#include <string>
 
 namespace reflect_cpp26 {
 namespace impl {
-template <class E, enum_entry_order Order>
-constexpr auto enum_names() /* -> std::array<std::string_view, N> */
+// Narrowest unsigned integral type that is able to hold MaxValue.
+template <size_t MaxValue>
+using enum_compact_uint_t = std::conditional_t<
+    MaxValue <= std::numeric_limits<uint8_t>::max(),
+    uint8_t,
+    std::conditional_t<MaxValue <= std::numeric_limits<uint16_t>::max(),
+                       uint16_t,
+                       std::conditional_t<MaxValue <= std::numeric_limits<uint32_t>::max(),
+                                          uint32_t,
+                                          uint64_t>>>;
+
+/**
+ * All names of E in original order, stored contiguously in a single static string.
+ * Adjacent names are separated by '\0' so that each name is null-terminated in place
+ * and can be referenced as meta_string_view.
+ */
+template <class E>
+consteval auto make_enum_name_pool() -> meta_string_view {
+  auto pool = std::string{};
+  auto is_first = true;
+  for (auto e : enum_meta_entries_v<E>) {
+    if (!is_first) {
+      pool.push_back('\0');
+    }
+    is_first = false;
+    pool.append(std::meta::identifier_of(e));
+  }
+  auto res = meta_string_view{};
+  res.head = std::define_static_string(pool);
+  res.n = pool.size();
+  return res;
+}
+
+template <class E>
+constexpr auto enum_name_pool_v = make_enum_name_pool<E>();
+
+template <class E>
+using enum_name_offset_t = enum_compact_uint_t<enum_name_pool_v<E>.n>;
+
+// Position of a name inside enum_name_pool_v<E>.
+template <class Offset>
+struct enum_name_slot {
+  Offset offset;
+  Offset length;
+
+  constexpr bool operator==(const enum_name_slot&) const = default;
+};
+
+template <class E>
+using enum_name_slot_t = enum_name_slot<enum_name_offset_t<E>>;
+
+template <class E, class Offset>
+constexpr auto enum_name_of_slot(enum_name_slot<Offset> slot) -> std::string_view {
+  return {enum_name_pool_v<E>.head + slot.offset, slot.length};
+}
+
+template <class E>
+consteval auto make_enum_name_slots() /* -> std::array<enum_name_slot_t<E>, N> */
 {
-  auto res = std::array<std::string_view, enum_count_v<E>>{};
+  using slot_t = enum_name_slot_t<E>;
+  auto res = std::array<slot_t, enum_count_v<E>>{};
+  auto offset = 0zU;
   auto index = 0zU;
-  for (auto e : enum_meta_entries_v<E, Order>) {
-    res[index++] = std::define_static_string(std::meta::identifier_of(e));
+  for (auto e : enum_meta_entries_v<E>) {
+    auto length = std::meta::identifier_of(e).length();
+    res[index++] = slot_t{
+        .offset = static_cast<enum_name_offset_t<E>>(offset),
+        .length = static_cast<enum_name_offset_t<E>>(length),
+    };
+    offset += length + 1;  // Including the '\0' separator
+  }
+  return res;
+}
+
+// Pool slots of all names in original order.
+template <class E>
+constexpr auto enum_name_slots_array_v = make_enum_name_slots<E>();
+
+template <class E, enum_entry_order Order>
+consteval auto make_enum_names() /* -> std::array<std::string_view, N> */
+{
+  constexpr auto N = enum_count_v<E>;
+  auto res = std::array<std::string_view, N>{};
+  for (auto i = 0zU; i < N; i++) {
+    res[i] = enum_name_of_slot<E>(enum_name_slots_array_v<E>[i]);
+  }
+  if constexpr (Order == enum_entry_order::by_name) {
+    std::ranges::sort(res);
+  } else if constexpr (Order != enum_entry_order::original) {
+    // Enumerator names are unique, thus each entry can be located in the pool by its name.
+    auto sorted = res;
+    std::ranges::sort(sorted);
+    auto index = 0zU;
+    for (auto e : enum_meta_entries_v<E, Order>) {
+      res[index++] = *std::ranges::lower_bound(sorted, std::meta::identifier_of(e));
+    }
   }
   return res;
 }
 
 template <class E, enum_entry_order Order>
-constexpr auto enum_names_array_v = enum_names<E, Order>();
+constexpr auto enum_names_array_v = make_enum_names<E, Order>();
 }  // namespace impl
 
 template <enum_type E, enum_entry_order Order = enum_entry_order::original>
@@ -23,8 +23,11 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
 #define REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
 
+#include <ranges>
 #include <reflect_cpp26/enum/enum_meta_entries.hpp>
+#include <reflect_cpp26/enum/impl/enum_unique_entries.hpp>
 #include <reflect_cpp26/utils/constant.hpp>
+#include <reflect_cpp26/utils/tags.hpp>
 #include <reflect_cpp26/utils/utility.hpp>
 #include <type_traits>
 
@@ -92,6 +95,55 @@ REFLECT_CPP26_ALWAYS_INLINE constexpr auto enum_switch_value(Func&& func, E valu
   }
   return init;
 }
+
+// Maps value to its enum_unique_index, or npos if value is not defined in E.
+// Subtraction is used directly if all the distinct values of E are contiguous.
+template <class E>
+REFLECT_CPP26_ALWAYS_INLINE constexpr auto enum_switch_dense_index(E value) -> size_t {
+  constexpr const auto& values = enum_unique_values_array_v<E>;
+  constexpr auto N = values.size();
+  if constexpr (N == 0) {
+    return npos;
+  } else {
+    constexpr auto min_value = static_cast<size_t>(promoted(values.front()));
+    constexpr auto max_value = static_cast<size_t>(promoted(values.back()));
+    if constexpr (max_value - min_value == N - 1) {
+      // Unsigned wrap-around rejects values less than min_value as well.
+      auto offset = static_cast<size_t>(promoted(value)) - min_value;
+      return offset < N ? offset : npos;
+    } else {
+      return enum_unique_index(value);
+    }
+  }
+}
+
+template <class R, class E, class Func>
+struct enum_switch_jump_table {
+  using handler_type = R (*)(Func&);
+
+  template <size_t I>
+  static constexpr auto handler(Func& func) -> R {
+    constexpr auto ev = enum_unique_values_array_v<E>[I];
+    if constexpr (std::is_void_v<R>) {
+      REFLECT_CPP26_ALWAYS_INLINE_CALL func(std::cw<ev>);
+    } else {
+      REFLECT_CPP26_ALWAYS_INLINE_CALL return func(std::cw<ev>);
+    }
+  }
+
+  static consteval auto make() {
+    constexpr auto N = enum_unique_count_v<E>;
+    auto res = std::array<handler_type, N>{};
+    template for (constexpr auto I : std::views::iota(0zU, N)) {
+      res[I] = &handler<I>;
+    }
+    return res;
+  }
+};
+
+// One handler per distinct value of E, indexed by enum_unique_index.
+template <class R, class E, class Func>
+constexpr auto enum_switch_jump_table_v = enum_switch_jump_table<R, E, Func>::make();
 }  // namespace impl
 
 template <enum_type E, class Func, class Fallback>
@@ -119,6 +171,59 @@ REFLECT_CPP26_ALWAYS_INLINE constexpr auto enum_switch(Func&& func, E value, T&&
   return impl::enum_switch_value<std::decay_t<T>>(
       std::forward<Func>(func), value, std::forward<T>(default_value));
 }
+
+// Jump-table mode: value is mapped to a dense index first, then dispatched via a table of
+// function pointers generated at compile time, which takes O(1) time regardless of the number
+// of enum entries.
+
+template <enum_type E, class Func, class Fallback>
+  requires(impl::enum_switch_invocable_r<void, E, Func> && std::is_invocable_r_v<void, Fallback, E>)
+REFLECT_CPP26_ALWAYS_INLINE constexpr void enum_switch(jump_table_tag_t,
+                                                       Func&& func,
+                                                       Fallback&& fallback,
+                                                       E value) {
+  auto index = impl::enum_switch_dense_index(value);
+  if (index == npos) {
+    fallback(value);
+    return;
+  }
+  using F = std::remove_reference_t<Func>;
+  impl::enum_switch_jump_table_v<void, E, F>[index](func);
+}
+
+template <non_reference_type T = void, enum_type E, class Func>
+  requires(impl::enum_switch_invocable_r<T, E, Func>)
+REFLECT_CPP26_ALWAYS_INLINE constexpr auto enum_switch(jump_table_tag_t, Func&& func, E value) {
+  using F = std::remove_reference_t<Func>;
+  auto index = impl::enum_switch_dense_index(value);
+  if constexpr (std::is_void_v<T>) {
+    // -> void
+    if (index != npos) {
+      impl::enum_switch_jump_table_v<void, E, F>[index](func);
+    }
+  } else {
+    // -> std::optional<T>
+    if (index == npos) {
+      return std::optional<T>{};
+    }
+    return std::optional<T>{impl::enum_switch_jump_table_v<T, E, F>[index](func)};
+  }
+}
+
+template <class T, enum_type E, class Func>
+  requires(impl::enum_switch_invocable_r<std::decay_t<T>, E, Func>)
+REFLECT_CPP26_ALWAYS_INLINE constexpr auto enum_switch(jump_table_tag_t,
+                                                       Func&& func,
+                                                       E value,
+                                                       T&& default_value) {
+  using R = std::decay_t<T>;
+  using F = std::remove_reference_t<Func>;
+  auto index = impl::enum_switch_dense_index(value);
+  if (index == npos) {
+    return R{std::forward<T>(default_value)};
+  }
+  return impl::enum_switch_jump_table_v<R, E, F>[index](func);
+}
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_FLAGS_TOKENIZER_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_FLAGS_TOKENIZER_HPP
+
+#include <reflect_cpp26/enum/impl/enum_maps.hpp>
+#include <reflect_cpp26/utils/ctype.hpp>
+#include <reflect_cpp26/utils/string_hash.hpp>
+#include <string_view>
+
+namespace reflect_cpp26::impl {
+struct enum_flags_token {
+  std::string_view text;  // With leading and trailing ASCII spaces trimmed
+  size_t hash;            // Hash value of text, by bkdr_hash or ascii_ci_bkdr_hash
+};
+
+constexpr auto delim_match_length(const char* cur, const char*, char delim) -> size_t {
+  return *cur == delim ? 1 : 0;
+}
+
+// Precondition: !delim.empty()
+constexpr auto delim_match_length(const char* cur, const char* end, std::string_view delim)
+    -> size_t {
+  auto n = delim.length();
+  if (*cur != delim.front() || static_cast<size_t>(end - cur) < n) {
+    return 0;
+  }
+  return std::string_view{cur, n} == delim ? n : 0;
+}
+
+template <bool CaseInsensitive>
+constexpr auto enum_flags_token_hash_step(size_t hash, char c) -> size_t {
+  if constexpr (CaseInsensitive) {
+    c = ascii_tolower(c);
+  }
+  return hash * bkdr_hash_p + static_cast<size_t>(c);
+}
+
+/**
+ * Splits str by delim in a single pass, with the same result as std::views::split followed by
+ * ascii_trim. Hash value of each trimmed token is computed during the same pass. func(token)
+ * is invoked for each non-empty token, and scanning stops once func returns false.
+ * Returns true if func returns true for all the tokens.
+ */
+template <bool CaseInsensitive, class Delim, class Func>
+constexpr bool for_each_enum_flags_token(std::string_view str, Delim delim, Func&& func) {
+  const auto* cur = str.data();
+  const auto* end = cur + str.length();
+
+  if constexpr (std::is_same_v<Delim, std::string_view>) {
+    if (delim.empty()) {
+      // Each character is a token, which is consistent with std::views::split.
+      for (; cur < end; ++cur) {
+        if (ascii_isspace(*cur)) {
+          continue;
+        }
+        auto hash = enum_flags_token_hash_step<CaseInsensitive>(0, *cur);
+        if (!func(enum_flags_token{{cur, 1}, hash})) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+  const char* head = nullptr;  // First non-space character of current token
+  const char* tail = nullptr;  // Past the last non-space character of current token
+  auto hash = 0zU;             // Hash value of [head, cur)
+  auto tail_hash = 0zU;        // Hash value of [head, tail)
+  while (cur < end) {
+    if (auto n = delim_match_length(cur, end, delim); n != 0) {
+      if (head != nullptr && !func(enum_flags_token{{head, tail}, tail_hash})) {
+        return false;
+      }
+      head = nullptr;
+      hash = 0;
+      cur += n;
+      continue;
+    }
+    auto c = *cur++;
+    if (ascii_isspace(c)) {
+      if (head != nullptr) {
+        hash = enum_flags_token_hash_step<CaseInsensitive>(hash, c);
+      }
+      continue;
+    }
+    if (head == nullptr) {
+      head = cur - 1;
+    }
+    hash = enum_flags_token_hash_step<CaseInsensitive>(hash, c);
+    tail = cur;
+    tail_hash = hash;
+  }
+  return head == nullptr || func(enum_flags_token{{head, tail}, tail_hash});
+}
+
+template <class E, bool CaseInsensitive>
+constexpr auto enum_from_string_map_ref() -> const auto& {
+  if constexpr (CaseInsensitive) {
+    return enum_from_ci_string_map_v<E>;
+  } else {
+    return enum_from_string_map_v<E>;
+  }
+}
+}  // namespace reflect_cpp26::impl
+
+#endif  // REFLECT_CPP26_ENUM_IMPL_ENUM_FLAGS_TOKENIZER_HPP
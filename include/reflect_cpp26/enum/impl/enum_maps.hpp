@@ -60,16 +60,15 @@ constexpr auto promoted(T value) {
 
 template <class E>
 consteval auto make_enum_name_map_kv_pairs() {
-  using kv_pair_t = std::pair<promoted_t<E>, meta_string_view>;
+  using kv_pair_t = std::pair<promoted_t<E>, enum_name_slot_t<E>>;
   auto res = std::vector<kv_pair_t>{};
   res.reserve(enum_count_v<E>);
 
   auto entries = enumerators_of(^^E);
-  const auto& names = enum_names_v<E>;
+  const auto& slots = enum_name_slots_array_v<E>;
   for (auto i = 0zU, n = enum_count_v<E>; i < n; i++) {
     auto ev = extract<E>(entries[i]);
-    auto msv = meta_string_view::from_std_string_view(names[i]);
-    res.emplace_back(promoted(ev), msv);
+    res.emplace_back(promoted(ev), slots[i]);
   }
   // Original order is preserved for multiple entries with the same underlying value
   std::ranges::stable_sort(res, {}, get_first);
@@ -123,18 +122,20 @@ consteval auto make_enum_from_ci_string_map() {
   return REFLECT_CPP26_STRING_KEY_FIXED_MAP(make_enum_from_string_kv_pairs<E>(), options);
 }
 
-union enum_indices_t {
-  struct {
-    uint16_t original;
-    uint16_t by_name;
-    uint16_t by_value;
-    uint16_t by_value_unique;
-  };
-  uint64_t as_u64;
+template <class IndexT>
+struct enum_indices_t {
+  IndexT original;
+  IndexT by_name;
+  IndexT by_value;
+  IndexT by_value_unique;
 };
 
-template <enum_entry_order Order>
-constexpr auto get(enum_indices_t indices) {
+// Index type is widened automatically with the number of enumerators.
+template <class E>
+using enum_index_uint_t = enum_compact_uint_t<enum_count_v<E>>;
+
+template <enum_entry_order Order, class IndexT>
+constexpr auto get(enum_indices_t<IndexT> indices) {
   if constexpr (Order == enum_entry_order::original) {
     return indices.original;
   } else if constexpr (Order == enum_entry_order::by_name) {
@@ -156,36 +157,34 @@ consteval auto make_enum_index_map_kv_pairs() {
     entry_tuples.emplace_back(i, std::meta::identifier_of(entries[i]));
   }
 
-  using kv_pair_t = std::pair<promoted_t<E>, enum_indices_t>;
+  using index_t = enum_index_uint_t<E>;
+  using kv_pair_t = std::pair<promoted_t<E>, enum_indices_t<index_t>>;
   auto res = std::vector<kv_pair_t>{};
   res.reserve(entries.size());
   for (auto i = 0zU, n = entries.size(); i < n; i++) {
     auto cur = entries[i];
     res.emplace_back(promoted(extract<E>(cur)),
-                     enum_indices_t{.original = static_cast<uint16_t>(i)});
+                     enum_indices_t<index_t>{.original = static_cast<index_t>(i)});
   }
   std::ranges::sort(entry_tuples, {}, get_second);
   for (auto i = 0zU, n = entries.size(); i < n; i++) {
-    res[entry_tuples[i].first].second.by_name = i;
+    res[entry_tuples[i].first].second.by_name = static_cast<index_t>(i);
   }
   // Original order is kept on underlying value duplication
   std::ranges::stable_sort(res, {}, get_first);
   for (auto i = 0zU, n = entries.size(); i < n; i++) {
-    res[i].second.by_value = i;
+    res[i].second.by_value = static_cast<index_t>(i);
   }
   auto [dup_begin, dup_end] = std::ranges::unique(res, {}, get_first);
   res.erase(dup_begin, dup_end);
   for (auto i = 0zU, m = res.size(); i < m; i++) {
-    res[i].second.by_value_unique = i;
+    res[i].second.by_value_unique = static_cast<index_t>(i);
   }
   return res;
 }
 
-constexpr auto enum_count_limit = std::numeric_limits<uint16_t>::max() - 1;
-
 template <class E>
 consteval auto make_enum_index_map() {
-  static_assert(enum_count_v<E> <= enum_count_limit, "Enum type too large.");
   constexpr auto options = integral_key_fixed_map_options{
       .already_sorted = true,
       .already_unique = true,
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_MEMBERSHIP_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_MEMBERSHIP_HPP
+
+#include <algorithm>
+#include <reflect_cpp26/enum/impl/enum_maps.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_span.hpp>
+#include <vector>
+
+namespace reflect_cpp26::impl {
+/**
+ * Existence-only lookup table of enum values. Keys in [min_key, min_key + n_bits) are tested
+ * with a bitmap. Keys out of this window (i.e. outliers) are stored in a sorted array.
+ */
+template <class Key>
+struct enum_membership {
+  using unsigned_key_type = std::make_unsigned_t<Key>;
+
+  Key min_key;
+  size_t n_bits;
+  meta_span<uint64_t> bitmap;
+  meta_span<Key> outliers;
+
+  constexpr bool contains(Key key) const {
+    // Wraps around for key < min_key, thus one comparison is enough for range check.
+    auto offset = static_cast<unsigned_key_type>(key) - static_cast<unsigned_key_type>(min_key);
+    if (offset < n_bits) {
+      return (bitmap[offset / 64] >> (offset % 64)) & 1;
+    }
+    return !outliers.empty() && std::ranges::binary_search(outliers, key);
+  }
+};
+
+// Bitmap window of at least this number of bits is always acceptable.
+constexpr auto enum_membership_min_bits = 256zU;
+// Otherwise, at most this number of bits per enum entry is spent on the bitmap window.
+constexpr auto enum_membership_bits_per_entry = 16zU;
+
+template <class E>
+consteval auto make_enum_membership() -> enum_membership<promoted_t<E>> {
+  using key_type = promoted_t<E>;
+  using unsigned_key_type = std::make_unsigned_t<key_type>;
+
+  auto keys = std::vector<key_type>{};
+  for (auto e : enum_meta_entries_v<E>) {
+    keys.push_back(promoted(extract<E>(e)));
+  }
+  std::ranges::sort(keys);
+  auto [dup_begin, dup_end] = std::ranges::unique(keys);
+  keys.erase(dup_begin, dup_end);
+  if (keys.empty()) {
+    return {.min_key = 0, .n_bits = 0, .bitmap = {}, .outliers = {}};
+  }
+  // Sliding window: finds [keys[best_i], keys[best_j]] that covers the most entries within
+  // the bitmap size limit.
+  auto max_bits = std::max(enum_membership_min_bits, enum_membership_bits_per_entry * keys.size());
+  auto span_of = [&keys](size_t i, size_t j) {
+    return static_cast<unsigned_key_type>(keys[j]) - static_cast<unsigned_key_type>(keys[i]);
+  };
+  auto best_i = 0zU;
+  auto best_j = 0zU;
+  for (auto i = 0zU, j = 0zU; j < keys.size(); j++) {
+    for (; span_of(i, j) >= max_bits; i++) {
+    }
+    if (j - i > best_j - best_i) {
+      best_i = i;
+      best_j = j;
+    }
+  }
+  auto n_bits = static_cast<size_t>(span_of(best_i, best_j)) + 1;
+  auto bitmap = std::vector<uint64_t>((n_bits + 63) / 64);
+  auto outliers = std::vector<key_type>{};
+  for (auto i = 0zU; i < keys.size(); i++) {
+    if (i >= best_i && i <= best_j) {
+      auto offset = static_cast<size_t>(span_of(best_i, i));
+      bitmap[offset / 64] |= uint64_t{1} << (offset % 64);
+    } else {
+      outliers.push_back(keys[i]);
+    }
+  }
+  return {
+      .min_key = keys[best_i],
+      .n_bits = n_bits,
+      .bitmap = reflect_cpp26::define_static_array(bitmap),
+      .outliers = reflect_cpp26::define_static_array(outliers),
+  };
+}
+
+template <class E>
+constexpr auto enum_membership_v = make_enum_membership<E>();
+}  // namespace reflect_cpp26::impl
+
+#endif  // REFLECT_CPP26_ENUM_IMPL_ENUM_MEMBERSHIP_HPP
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_UNIQUE_ENTRIES_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_UNIQUE_ENTRIES_HPP
+
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+
+namespace reflect_cpp26::impl {
+// Distinct values of E sorted in ascending order, i.e. the i-th element is the value whose
+// enum_unique_index is i.
+template <class E>
+consteval auto make_enum_unique_values() /* -> std::array<E, N> */ {
+  auto res = std::array<E, enum_unique_count_v<E>>{};
+  auto index = 0zU;
+  for (auto ev : enum_values_v<E, enum_entry_order::by_value>) {
+    if (index == 0 || res[index - 1] != ev) {
+      res[index++] = ev;
+    }
+  }
+  return res;
+}
+
+// Unique indices of distinct values of E, visited in given order. For multiple entries
+// with the same underlying value, only the first one is taken.
+template <class E, enum_entry_order Order>
+consteval auto make_enum_unique_index_order() /* -> std::array<enum_index_uint_t<E>, N> */ {
+  constexpr auto N = enum_unique_count_v<E>;
+  auto res = std::array<enum_index_uint_t<E>, N>{};
+  auto visited = std::array<bool, N>{};
+  auto index = 0zU;
+  for (auto ev : enum_values_v<E, Order>) {
+    auto i = enum_unique_index(ev);
+    if (!visited[i]) {
+      visited[i] = true;
+      res[index++] = static_cast<enum_index_uint_t<E>>(i);
+    }
+  }
+  return res;
+}
+
+template <class E>
+constexpr auto enum_unique_values_array_v = make_enum_unique_values<E>();
+
+template <class E, enum_entry_order Order>
+constexpr auto enum_unique_index_order_array_v = make_enum_unique_index_order<E, Order>();
+}  // namespace reflect_cpp26::impl
+
+#endif  // REFLECT_CPP26_ENUM_IMPL_ENUM_UNIQUE_ENTRIES_HPP
@@ -51,7 +51,16 @@ public:
     if (len < min_length || len > max_length) {
       return std::nullopt;
     }
-    auto hash = Policy<CharT>::hash(key);
+    return find_hashed(key, Policy<CharT>::hash(key));
+  }
+
+  // Precondition: hash == Policy<CharT>::hash(key)
+  constexpr auto find_hashed(std::basic_string_view<CharT> key, size_t hash) const
+      -> std::optional<const value_type&> {
+    auto len = key.length();
+    if (len < min_length || len > max_length) {
+      return std::nullopt;
+    }
     for (const auto& cur : entries) {
       if (hash != cur.elements.first) continue;
       if (Policy<CharT>::equals(cur.elements.second, key)) {
@@ -92,7 +101,16 @@ public:
     if (len < min_length || len > max_length) {
       return std::nullopt;
     }
-    auto hash = Policy<CharT>::hash(key);
+    return find_hashed(key, Policy<CharT>::hash(key));
+  }
+
+  // Precondition: hash == Policy<CharT>::hash(key)
+  constexpr auto find_hashed(std::basic_string_view<CharT> key, size_t hash) const
+      -> std::optional<const value_type&> {
+    auto len = key.length();
+    if (len < min_length || len > max_length) {
+      return std::nullopt;
+    }
     constexpr auto hash_proj = [](const auto& entry) { return unwrap(entry).elements.first; };
     if constexpr (C) {
       auto range = std::ranges::equal_range(entries, hash, {}, hash_proj);
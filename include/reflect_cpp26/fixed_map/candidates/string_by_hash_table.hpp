@@ -52,7 +52,16 @@ public:
     if (len < min_length || len > max_length) {
       return std::nullopt;
     }
-    auto key_hash = Policy<CharT>::hash(key);
+    return find_hashed(key, Policy<CharT>::hash(key));
+  }
+
+  // Precondition: key_hash == Policy<CharT>::hash(key)
+  constexpr auto find_hashed(std::basic_string_view<CharT> key, size_t key_hash) const
+      -> std::optional<const value_type&> {
+    auto len = key.length();
+    if (len < min_length || len > max_length) {
+      return std::nullopt;
+    }
     auto start_index = key_hash % modulo;
     template for (constexpr auto I : std::views::iota(0zU, P)) {
       const auto& cur = unwrap(entries[start_index + I * I]).elements;
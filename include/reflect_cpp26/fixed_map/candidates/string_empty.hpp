@@ -42,6 +42,11 @@ public:
     return std::nullopt;
   }
 
+  static constexpr auto find_hashed(std::basic_string_view<CharT>, size_t)
+      -> std::optional<const value_type&> {
+    return std::nullopt;
+  }
+
   constexpr auto operator[](std::basic_string_view<CharT>) const -> const value_type& {
     return default_v<value_type>;
   }
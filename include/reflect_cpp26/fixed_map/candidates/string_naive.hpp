@@ -54,6 +54,12 @@ public:
     return std::nullopt;
   }
 
+  // Hash value is not used.
+  constexpr auto find_hashed(std::basic_string_view<CharT> key, size_t) const
+      -> std::optional<const value_type&> {
+    return find(key);
+  }
+
   constexpr auto operator[](std::basic_string_view<CharT> key) const -> const value_type& {
     auto p = find(key);
     return p ? *p : default_v<value_type>;
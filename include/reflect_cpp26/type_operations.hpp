@@ -23,8 +23,14 @@
 #ifndef REFLECT_CPP26_TYPE_OPERATIONS_HPP
 #define REFLECT_CPP26_TYPE_OPERATIONS_HPP
 
+#include <reflect_cpp26/type_operations/class_schema_hash.hpp>
+#include <reflect_cpp26/type_operations/deserialize_from_json.hpp>
+#include <reflect_cpp26/type_operations/deserialize_from_json_stream.hpp>
 #include <reflect_cpp26/type_operations/dump_to_json_like.hpp>
+#include <reflect_cpp26/type_operations/json_document.hpp>
 #include <reflect_cpp26/type_operations/serialize_to_json.hpp>
+#include <reflect_cpp26/type_operations/serialize_to_json_parallel.hpp>
 #include <reflect_cpp26/type_operations/to_structural.hpp>
+#include <reflect_cpp26/type_operations/validate_json.hpp>
 
 #endif  // REFLECT_CPP26_TYPE_OPERATIONS_HPP
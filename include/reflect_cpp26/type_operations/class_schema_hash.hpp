@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_CLASS_SCHEMA_HASH_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_CLASS_SCHEMA_HASH_HPP
+
+#include <climits>
+#include <ranges>
+#include <reflect_cpp26/enum/enum_hash.hpp>
+#include <reflect_cpp26/type_traits/class_types/flattened_nsdm.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_utility.hpp>
+#include <reflect_cpp26/utils/string_builder.hpp>
+#include <reflect_cpp26/utils/string_hash.hpp>
+
+namespace reflect_cpp26 {
+struct class_schema_fingerprint {
+  uint64_t low;
+  uint64_t high;
+
+  constexpr bool operator==(const class_schema_fingerprint&) const = default;
+};
+
+namespace impl {
+// Seed of the higher 64 bits of class_schema_fingerprint.
+constexpr auto class_schema_fingerprint_high_seed = uint64_t{0x5F3C9A1D2B7E4068};
+
+template <class T>
+consteval void append_type_schema(string_builder& dest);
+
+template <class T>
+consteval void append_size_and_alignment(string_builder& dest) {
+  dest.append_char('(').append_integer(sizeof(T));
+  dest.append_char(',').append_integer(alignof(T)).append_char(')');
+}
+
+template <class T>
+consteval void append_class_schema(string_builder& dest) {
+  dest.append_char('{');
+  append_size_and_alignment<T>(dest);
+  constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  template for (constexpr auto I : std::views::iota(0zU, std::size(members))) {
+    constexpr auto m = members[I];
+    dest.append_string(reflect_cpp26::identifier_of(m.member)).append_char(':');
+    append_type_schema<typename [:m.type():]>(dest);
+    dest.append_char('@').append_integer(m.actual_offset_bits());
+    if constexpr (is_bit_field(m.member)) {
+      dest.append_char('/').append_integer(bit_size_of(m.member));
+    }
+    dest.append_char(';');
+  }
+  dest.append_char('}');
+}
+
+/**
+ * Canonical layout descriptor of T. Arithmetic types are described by kind and width only,
+ * so that aliases with identical representation (e.g. long and long long on LP64) are
+ * treated as the same.
+ */
+template <class T>
+consteval void append_type_schema(string_builder& dest) {
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, bool>) {
+    dest.append_char('b');
+  } else if constexpr (std::is_floating_point_v<U>) {
+    dest.append_char('f').append_integer(sizeof(U) * CHAR_BIT);
+  } else if constexpr (std::is_integral_v<U>) {
+    dest.append_char(std::is_signed_v<U> ? 'i' : 'u').append_integer(sizeof(U) * CHAR_BIT);
+  } else if constexpr (std::is_enum_v<U>) {
+    // Entries of nested enum types are covered by enum_hash_v.
+    dest.append_char('e');
+    append_type_schema<std::underlying_type_t<U>>(dest);
+    dest.append_char('#').append_integer(enum_hash_v<U>);
+  } else if constexpr (std::is_array_v<U>) {
+    dest.append_char('[').append_integer(std::extent_v<U>).append_char(']');
+    append_type_schema<std::remove_extent_t<U>>(dest);
+  } else if constexpr (std::is_pointer_v<U> || std::is_member_pointer_v<U>
+                       || std::is_null_pointer_v<U>) {
+    dest.append_char('p');
+    append_size_and_alignment<U>(dest);
+  } else if constexpr (!std::is_union_v<U> && flattenable_class<U>) {
+    append_class_schema<U>(dest);
+  } else {
+    // Opaque types (e.g. std::string, unions): only name and layout are known. The name is
+    // implementation-defined, thus schemas with opaque members are toolchain-specific.
+    dest.append_char('<').append_string(display_string_of(dealias(^^U))).append_char('>');
+    append_size_and_alignment<U>(dest);
+  }
+}
+
+template <class T>
+consteval auto make_class_schema() -> meta_string_view {
+  auto dest = string_builder{};
+  append_type_schema<T>(dest);
+  return reflect_cpp26::define_static_string(dest.strview());
+}
+}  // namespace impl
+
+/**
+ * Canonical descriptor of the memberwise layout of T, covering names, types, bit offsets
+ * (and bit-field widths) of all the flattened non-static data members, recursively.
+ * Members of opaque types are described by display_string_of, whose output is
+ * implementation-defined: such schemas (and hashes) are comparable only within one toolchain
+ * and standard library.
+ */
+template <flattenable_class T>
+constexpr auto class_schema_v = impl::make_class_schema<std::remove_cv_t<T>>();
+
+// 64-bit schema hash. Equal hashes indicate identical memberwise layout.
+template <flattenable_class T>
+constexpr uint64_t class_schema_hash_v = xxh64_hash(class_schema_v<T>);
+
+// 128-bit schema fingerprint, for use cases where 64-bit hash collision is unacceptable.
+template <flattenable_class T>
+constexpr auto class_schema_fingerprint_v = class_schema_fingerprint{
+    .low = class_schema_hash_v<T>,
+    .high = xxh64_hash(class_schema_v<T>, impl::class_schema_fingerprint_high_seed),
+};
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_CLASS_SCHEMA_HASH_HPP
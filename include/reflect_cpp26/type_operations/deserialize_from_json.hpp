@@ -0,0 +1,1369 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_flags_cast.hpp>
+#include <reflect_cpp26/enum/enum_flags_contains.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/impl/enum_maps.hpp>
+#include <reflect_cpp26/fixed_map/string_key.hpp>
+#include <reflect_cpp26/type_operations/impl/json_structural_index.hpp>
+#include <reflect_cpp26/type_operations/to_structural.hpp>
+#include <reflect_cpp26/type_traits/enum_types.hpp>
+#include <reflect_cpp26/type_traits/serializable_types.hpp>
+#include <reflect_cpp26/type_traits/template_instance.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/functional_tuple.hpp>
+#include <reflect_cpp26/utils/number_parsing.hpp>
+#include <reflect_cpp26/utils/string_encoding.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace reflect_cpp26 {
+struct deserialize_options {
+  // Whether object keys that match no member are skipped. Otherwise deserialization fails.
+  bool ignores_unknown_keys = true;
+  // Whether deserialization fails if any member is absent from the JSON object.
+  // Otherwise absent members keep their previous values.
+  bool requires_all_members = false;
+  // Whether deserialization fails if an integer is not a valid enum value.
+  bool rejects_invalid_enum = false;
+};
+
+/**
+ * Bump allocator over caller-provided storage, from which in-situ deserialization allocates
+ * elements of std::span<T> values. Elements are never destroyed (thus required to be trivially
+ * destructible), and storage is reclaimed all at once with reset().
+ */
+class json_arena {
+public:
+  json_arena() = default;
+
+  explicit json_arena(std::span<std::byte> storage)
+      : first_(storage.data()), cur_(storage.data()), last_(storage.data() + storage.size()) {}
+
+  // Returns nullptr if the remaining storage is insufficient.
+  auto allocate(size_t size, size_t alignment) -> void* {
+    void* res = cur_;
+    auto space = static_cast<size_t>(last_ - cur_);
+    if (std::align(alignment, size, res, space) == nullptr) {
+      return nullptr;
+    }
+    cur_ = static_cast<std::byte*>(res) + size;
+    return res;
+  }
+
+  auto used() const -> size_t {
+    return cur_ - first_;
+  }
+
+  auto capacity() const -> size_t {
+    return last_ - first_;
+  }
+
+  void reset() {
+    cur_ = first_;
+  }
+
+private:
+  std::byte* first_ = nullptr;
+  std::byte* cur_ = nullptr;
+  std::byte* last_ = nullptr;
+};
+
+namespace impl::json {
+struct json_decode_context_access;
+}  // namespace impl::json
+
+/**
+ * Reusable state for deserializing many messages. Containers with polymorphic allocators (e.g.
+ * std::pmr::string and std::pmr::vector) allocate from a monotonic buffer, which is released all
+ * at once by reset(). The buffer of the structural index is reused across messages as well.
+ */
+class json_decode_context {
+public:
+  json_decode_context() = default;
+
+  // Allocates from initial_buffer first, then from upstream if it runs out.
+  explicit json_decode_context(
+      std::span<std::byte> initial_buffer,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : buffer_(initial_buffer.data(), initial_buffer.size(), upstream) {}
+
+  json_decode_context(const json_decode_context&) = delete;
+  auto operator=(const json_decode_context&) -> json_decode_context& = delete;
+
+  auto resource() -> std::pmr::memory_resource* {
+    return &buffer_;
+  }
+
+  // Values deserialized with this context must be destroyed (or no longer used) before reset.
+  // O(1) unless the initial buffer has run out.
+  void reset() {
+    buffer_.release();
+  }
+
+private:
+  friend struct impl::json::json_decode_context_access;
+
+  std::pmr::monotonic_buffer_resource buffer_;
+  std::vector<uint32_t> structurals_;
+};
+
+namespace impl::json {
+// Values skipped (e.g. values of unknown keys) can be nested up to this depth.
+constexpr auto json_max_skip_depth = 1024zU;
+
+// Inputs no shorter than this are indexed by stage one (see json_structural_index.hpp) first.
+constexpr auto json_structural_index_min_size = 1024zU;
+
+constexpr bool is_json_whitespace(char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+struct json_decode_context_access {
+  static auto structurals(json_decode_context& context) -> std::vector<uint32_t>& {
+    return context.structurals_;
+  }
+};
+
+struct json_reader {
+  const char* cur;
+  const char* end;
+  // Structural index [next_structural, last_structural) as offsets from begin, or null if input
+  // is read byte by byte.
+  const char* begin = nullptr;
+  const uint32_t* next_structural = nullptr;
+  const uint32_t* last_structural = nullptr;
+  // In-situ mode: input is mutable, where strings may be unescaped in place.
+  bool in_situ = false;
+  // Validation mode (validate_json and lookahead of in-situ mode): input is not modified, and
+  // strings, containers and spans are validated without being stored or allocated.
+  bool dry_run = false;
+  json_arena* arena = nullptr;
+  // Memory resource to which values with polymorphic allocators are rebound, or null.
+  std::pmr::memory_resource* resource = nullptr;
+
+  constexpr void skip_whitespace() {
+    if (next_structural != nullptr) {
+      skip_to_next_structural();
+      return;
+    }
+    while (cur < end && is_json_whitespace(*cur)) {
+      ++cur;
+    }
+  }
+
+  // Jumps over whitespaces via the structural index. Any non-whitespace byte between tokens
+  // stays at cur so that stage two fails on it.
+  constexpr void skip_to_next_structural() {
+    auto offset = static_cast<uint32_t>(cur - begin);
+    while (next_structural < last_structural && *next_structural < offset) {
+      ++next_structural;
+    }
+    const auto* next = next_structural < last_structural ? begin + *next_structural : end;
+    if (cur == next || !is_json_whitespace(*cur)) {
+      return;
+    }
+    cur = next;
+  }
+
+  // Precondition: skip_whitespace() is called.
+  // Returns the closing quote located by the structural index, or nullptr if unavailable
+  // (including the case that no string starts at cur).
+  constexpr auto indexed_closing_quote() const -> const char* {
+    if (next_structural == nullptr || last_structural - next_structural < 2
+        || begin + next_structural[0] != cur || *cur != '"') {
+      return nullptr;
+    }
+    return begin + next_structural[1];
+  }
+
+  // Returns the next character after whitespaces, or '\0' at the end of input.
+  constexpr char peek() {
+    skip_whitespace();
+    return cur < end ? *cur : '\0';
+  }
+
+  constexpr bool consume(char c) {
+    skip_whitespace();
+    if (cur < end && *cur == c) {
+      ++cur;
+      return true;
+    }
+    return false;
+  }
+
+  // Consumes token if the next characters after whitespaces match it exactly.
+  constexpr bool consume_token(std::string_view token) {
+    skip_whitespace();
+    if (static_cast<size_t>(end - cur) < token.size()) {
+      return false;
+    }
+    if (std::string_view{cur, token.size()} != token) {
+      return false;
+    }
+    cur += token.size();
+    return true;
+  }
+
+  template <size_t N>
+  constexpr bool consume_literal(const char (&literal)[N]) {
+    return consume_token({literal, N - 1});
+  }
+
+  constexpr bool at_end() {
+    skip_whitespace();
+    return cur == end;
+  }
+};
+
+// -------- Scalars --------
+
+// Skips a number following the grammar of RFC 8259.
+constexpr bool skip_json_number(json_reader& reader) {
+  reader.skip_whitespace();
+  const auto* p = reader.cur;
+  const auto* end = reader.end;
+  auto skip_digits = [&p, end]() {
+    auto* first = p;
+    for (; p < end && ascii_isdigit(*p); ++p) {}
+    return p != first;
+  };
+
+  if (p < end && *p == '-') {
+    ++p;
+  }
+  if (p < end && *p == '0') {
+    ++p;
+  } else if (!skip_digits()) {
+    return false;
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    if (!skip_digits()) return false;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p < end && (*p == '+' || *p == '-')) {
+      ++p;
+    }
+    if (!skip_digits()) return false;
+  }
+  reader.cur = p;
+  return true;
+}
+
+template <class T>
+constexpr bool read_json_integer(json_reader& reader, T& value) {
+  // Character types are parsed as the integer type of the same size and signedness.
+  using IntT = integral_to_integer_t<T>;
+  reader.skip_whitespace();
+  auto res = IntT{};
+  auto [ptr, ec] = parse_integer(reader.cur, reader.end, res);
+  if (ec != std::errc{}) {
+    return false;
+  }
+  // Fractions and exponents are not allowed, even if the value is integral.
+  if (ptr < reader.end && (*ptr == '.' || *ptr == 'e' || *ptr == 'E')) {
+    return false;
+  }
+  reader.cur = ptr;
+  value = static_cast<T>(res);
+  return true;
+}
+
+// Non-finite values are read from strings "NaN", "Infinity" and "-Infinity" as written by
+// serialize_to_json.
+template <class T>
+constexpr bool read_json_floating_point(json_reader& reader, T& value) {
+  reader.skip_whitespace();
+  if (reader.cur < reader.end && *reader.cur == '"') [[unlikely]] {
+    using limits = std::numeric_limits<T>;
+    if (reader.consume_literal("\"NaN\"")) {
+      value = limits::quiet_NaN();
+    } else if (reader.consume_literal("\"Infinity\"")) {
+      value = limits::infinity();
+    } else if (reader.consume_literal("\"-Infinity\"")) {
+      value = -limits::infinity();
+    } else {
+      return false;
+    }
+    return true;
+  }
+  auto [ptr, ec] = parse_floating_point(reader.cur, reader.end, value);
+  if (ec != std::errc{}) {
+    return false;
+  }
+  reader.cur = ptr;
+  return true;
+}
+
+// -------- Strings --------
+
+// Finds the first '"', '\\' or control character (which must be escaped).
+constexpr auto find_json_string_special(const char* cur, const char* end) -> const char* {
+  for (; cur < end; ++cur) {
+    auto c = static_cast<unsigned char>(*cur);
+    if (c == '"' || c == '\\' || c < 0x20) {
+      break;
+    }
+  }
+  return cur;
+}
+
+constexpr auto read_json_hex4(const char* p) -> char32_t {
+  auto res = char32_t{0};
+  for (auto i = 0; i < 4; i++) {
+    auto c = p[i];
+    auto digit = (c >= '0' && c <= '9')   ? c - '0'
+                 : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+                 : (c >= 'A' && c <= 'F') ? c - 'A' + 10
+                                          : -1;
+    if (digit < 0) {
+      return invalid_code_point;
+    }
+    res = res * 16 + digit;
+  }
+  return res;
+}
+
+// Precondition: reader.cur points to the character after '\\'.
+// Returns invalid_code_point if the escape sequence is malformed.
+constexpr auto read_json_escape(json_reader& reader) -> char32_t {
+  if (reader.cur == reader.end) {
+    return invalid_code_point;
+  }
+  switch (*reader.cur++) {
+    case '"':
+      return '"';
+    case '\\':
+      return '\\';
+    case '/':
+      return '/';
+    case 'b':
+      return '\b';
+    case 'f':
+      return '\f';
+    case 'n':
+      return '\n';
+    case 'r':
+      return '\r';
+    case 't':
+      return '\t';
+    case 'u':
+      break;
+    default:
+      return invalid_code_point;
+  }
+  if (reader.end - reader.cur < 4) {
+    return invalid_code_point;
+  }
+  auto c = read_json_hex4(reader.cur);
+  reader.cur += 4;
+  if (c == invalid_code_point || is_low_surrogate(c)) {
+    return invalid_code_point;
+  }
+  if (!is_high_surrogate(c)) {
+    return c;
+  }
+  // Surrogate pair, e.g. "\\ud83d\\ude00"
+  if (reader.end - reader.cur < 6 || reader.cur[0] != '\\' || reader.cur[1] != 'u') {
+    return invalid_code_point;
+  }
+  auto low = read_json_hex4(reader.cur + 2);
+  if (low == invalid_code_point || !is_low_surrogate(low)) {
+    return invalid_code_point;
+  }
+  reader.cur += 6;
+  return 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+}
+
+template <class CharT, class Traits, class Allocator>
+constexpr void append_code_point(std::basic_string<CharT, Traits, Allocator>& dest, char32_t c) {
+  CharT buffer[4];
+  auto* buffer_end = encode_code_point_unsafe(buffer, c);
+  dest.append(buffer, buffer_end);
+}
+
+// Appends UTF-8 input [first, last) that contains no escape sequence. Input is copied as-is to
+// strings of 1-byte characters, or transcoded to UTF-16 or UTF-32 otherwise.
+template <class CharT, class Traits, class Allocator>
+constexpr bool append_json_string_run(std::basic_string<CharT, Traits, Allocator>& dest,
+                                      const char* first,
+                                      const char* last) {
+  if constexpr (sizeof(CharT) == 1) {
+    dest.append(first, last);
+  } else {
+    while (first < last) {
+      auto [c, next] = decode_code_point_from_utf8(first, last);
+      if (c == invalid_code_point) [[unlikely]] {
+        return false;
+      }
+      append_code_point(dest, c);
+      first = next;
+    }
+  }
+  return true;
+}
+
+template <class CharT, class Traits, class Allocator>
+constexpr bool read_json_string(json_reader& reader,
+                                std::basic_string<CharT, Traits, Allocator>& dest) {
+  dest.clear();
+  reader.skip_whitespace();
+  if (const auto* close = reader.indexed_closing_quote()) {
+    // Control characters in strings are already rejected by stage one.
+    const auto* first = reader.cur + 1;
+    if (std::char_traits<char>::find(first, close - first, '\\') == nullptr) {
+      reader.cur = close + 1;
+      return append_json_string_run(dest, first, close);
+    }
+  }
+  if (!reader.consume('"')) {
+    return false;
+  }
+  while (true) {
+    const auto* run_end = find_json_string_special(reader.cur, reader.end);
+    if (!append_json_string_run(dest, reader.cur, run_end) || run_end == reader.end) {
+      return false;
+    }
+    reader.cur = run_end + 1;
+    if (*run_end == '"') {
+      return true;
+    }
+    if (*run_end != '\\') {
+      return false;  // Unescaped control character
+    }
+    auto c = read_json_escape(reader);
+    if (c == invalid_code_point) {
+      return false;
+    }
+    append_code_point(dest, c);
+  }
+}
+
+// Validates a string the same way as read_json_string into std::basic_string<CharT> without
+// allocation. Returns the number of code units of the result.
+template <class CharT>
+constexpr auto validate_json_string(json_reader& reader) -> std::optional<size_t> {
+  if (!reader.consume('"')) {
+    return std::nullopt;
+  }
+  auto n = 0zU;
+  while (true) {
+    const auto* run_end = find_json_string_special(reader.cur, reader.end);
+    if constexpr (sizeof(CharT) == 1) {
+      n += run_end - reader.cur;
+    } else {
+      for (const auto* p = reader.cur; p < run_end;) {
+        auto [c, next] = decode_code_point_from_utf8(p, run_end);
+        if (c == invalid_code_point) [[unlikely]] {
+          return std::nullopt;
+        }
+        n += (sizeof(CharT) == 2) ? utf16_encoded_length(c) : 1;
+        p = next;
+      }
+    }
+    if (run_end == reader.end) {
+      return std::nullopt;
+    }
+    reader.cur = run_end + 1;
+    if (*run_end == '"') {
+      return n;
+    }
+    if (*run_end != '\\') {
+      return std::nullopt;  // Unescaped control character
+    }
+    auto c = read_json_escape(reader);
+    if (c == invalid_code_point) {
+      return std::nullopt;
+    }
+    n += (sizeof(CharT) == 1)   ? utf8_encoded_length(c)
+         : (sizeof(CharT) == 2) ? utf16_encoded_length(c)
+                                : 1;
+  }
+}
+
+// Reads a string as a view into the input. Strings without escape sequences are referred to
+// directly, otherwise unescaped in place (escape sequences are never shorter than their results).
+// Precondition: reader is in in-situ mode.
+constexpr bool read_json_string_in_situ(json_reader& reader, std::string_view& dest) {
+  reader.skip_whitespace();
+  if (reader.cur == reader.end || *reader.cur != '"') {
+    return false;
+  }
+  auto* first = const_cast<char*>(reader.cur + 1);
+  if (const auto* close = reader.indexed_closing_quote()) {
+    if (std::char_traits<char>::find(first, close - first, '\\') == nullptr) {
+      reader.cur = close + 1;
+      dest = {first, close};
+      return true;
+    }
+  }
+  auto* out = first;
+  reader.cur = first;
+  while (true) {
+    const auto* run_end = find_json_string_special(reader.cur, reader.end);
+    if (run_end == reader.end) {
+      return false;
+    }
+    if (out != reader.cur) {
+      std::char_traits<char>::move(out, reader.cur, run_end - reader.cur);
+    }
+    out += run_end - reader.cur;
+    reader.cur = run_end + 1;
+    if (*run_end == '"') {
+      dest = {first, out};
+      return true;
+    }
+    if (*run_end != '\\') {
+      return false;  // Unescaped control character
+    }
+    auto c = read_json_escape(reader);
+    if (c == invalid_code_point) {
+      return false;
+    }
+    out = encode_code_point_unsafe(out, c);
+  }
+}
+
+// Reads a string as a view into the input if it contains no escape sequence (or in in-situ
+// mode), or into the buffer otherwise.
+constexpr auto read_json_string_view(json_reader& reader, std::string& buffer)
+    -> std::optional<std::string_view> {
+  reader.skip_whitespace();
+  if (reader.cur == reader.end || *reader.cur != '"') {
+    return std::nullopt;
+  }
+  const auto* first = reader.cur + 1;
+  const char* run_end = nullptr;
+  if (const auto* close = reader.indexed_closing_quote()) {
+    run_end = std::char_traits<char>::find(first, close - first, '\\');
+    run_end = (run_end == nullptr) ? close : run_end;
+  } else {
+    run_end = find_json_string_special(first, reader.end);
+  }
+  if (run_end < reader.end && *run_end == '"') {
+    reader.cur = run_end + 1;
+    return std::string_view{first, run_end};
+  }
+  if (reader.in_situ && !reader.dry_run) {
+    auto res = std::string_view{};
+    if (!read_json_string_in_situ(reader, res)) {
+      return std::nullopt;
+    }
+    return res;
+  }
+  if (!read_json_string(reader, buffer)) {
+    return std::nullopt;
+  }
+  return std::string_view{buffer};
+}
+
+// Same as above without allocation, for keys and names known at compile time: strings with
+// escape sequences are unescaped into buffer. Content that does not fit is returned as-is
+// (including backslashes), which matches no member or enumerator name.
+template <size_t N>
+constexpr auto read_json_string_view(json_reader& reader, std::array<char, N>& buffer)
+    -> std::optional<std::string_view> {
+  reader.skip_whitespace();
+  if (const auto* close = reader.indexed_closing_quote()) {
+    const auto* first = reader.cur + 1;
+    if (std::char_traits<char>::find(first, close - first, '\\') == nullptr) {
+      reader.cur = close + 1;
+      return std::string_view{first, close};
+    }
+  }
+  if (!reader.consume('"')) {
+    return std::nullopt;
+  }
+  const auto* first = reader.cur;
+  auto* out = buffer.data();
+  auto fits = true;
+  while (true) {
+    const auto* run_end = find_json_string_special(reader.cur, reader.end);
+    if (run_end == reader.end) {
+      return std::nullopt;
+    }
+    if (*run_end == '"' && reader.cur == first) {
+      reader.cur = run_end + 1;
+      return std::string_view{first, run_end};
+    }
+    auto run_size = static_cast<size_t>(run_end - reader.cur);
+    fits = fits && run_size <= static_cast<size_t>(buffer.data() + N - out);
+    if (fits) {
+      out = std::ranges::copy(reader.cur, run_end, out).out;
+    }
+    reader.cur = run_end + 1;
+    if (*run_end == '"') {
+      return fits ? std::string_view{buffer.data(), out} : std::string_view{first, run_end};
+    }
+    if (*run_end != '\\') {
+      return std::nullopt;  // Unescaped control character
+    }
+    auto c = read_json_escape(reader);
+    if (c == invalid_code_point) {
+      return std::nullopt;
+    }
+    fits = fits && utf8_encoded_length(c) <= static_cast<size_t>(buffer.data() + N - out);
+    if (fits) {
+      out = encode_code_point_unsafe(out, c);
+    }
+  }
+}
+
+// -------- Skipping --------
+
+constexpr bool skip_json_string(json_reader& reader) {
+  reader.skip_whitespace();
+  if (const auto* close = reader.indexed_closing_quote()) {
+    const auto* first = reader.cur + 1;
+    if (std::char_traits<char>::find(first, close - first, '\\') == nullptr) {
+      reader.cur = close + 1;
+      return true;
+    }
+  }
+  if (!reader.consume('"')) {
+    return false;
+  }
+  while (true) {
+    reader.cur = find_json_string_special(reader.cur, reader.end);
+    if (reader.cur == reader.end) {
+      return false;
+    }
+    auto c = *reader.cur++;
+    if (c == '"') {
+      return true;
+    }
+    if (c != '\\' || read_json_escape(reader) == invalid_code_point) {
+      return false;
+    }
+  }
+}
+
+constexpr bool skip_json_value(json_reader& reader, size_t depth = 0) {
+  if (depth >= json_max_skip_depth) [[unlikely]] {
+    return false;
+  }
+  switch (reader.peek()) {
+    case '"':
+      return skip_json_string(reader);
+    case 't':
+      return reader.consume_literal("true");
+    case 'f':
+      return reader.consume_literal("false");
+    case 'n':
+      return reader.consume_literal("null");
+    case '[':
+      ++reader.cur;
+      if (reader.consume(']')) {
+        return true;
+      }
+      do {
+        if (!skip_json_value(reader, depth + 1)) return false;
+      } while (reader.consume(','));
+      return reader.consume(']');
+    case '{':
+      ++reader.cur;
+      if (reader.consume('}')) {
+        return true;
+      }
+      do {
+        if (!skip_json_string(reader) || !reader.consume(':')) return false;
+        if (!skip_json_value(reader, depth + 1)) return false;
+      } while (reader.consume(','));
+      return reader.consume('}');
+    default:
+      return skip_json_number(reader);
+  }
+}
+
+// -------- Compound Types --------
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_value(json_reader& reader, T& value);
+
+// Upper bound of string sizes accepted as E: the longest enumerator name, or all the flags
+// joined with delimiters for enum flag types.
+template <class E>
+consteval auto make_enum_json_max_name_size() -> size_t {
+  auto max_size = 0zU;
+  auto total_size = 0zU;
+  for (auto name : enum_names_v<E>) {
+    max_size = std::max(max_size, name.size());
+    total_size += name.size() + 1;
+  }
+  return enum_flag_type<E> ? total_size : max_size;
+}
+
+template <class E>
+constexpr auto enum_json_max_name_size_v = make_enum_json_max_name_size<E>();
+
+template <deserialize_options Options, class E>
+constexpr bool read_json_enum(json_reader& reader, E& value) {
+  if (reader.peek() == '"') {
+    auto buffer = std::array<char, enum_json_max_name_size_v<E>>{};
+    auto name = read_json_string_view(reader, buffer);
+    if (!name.has_value()) {
+      return false;
+    }
+    if (auto v = enum_from_string_map_v<E>.find(*name)) {
+      value = static_cast<E>(*v);
+      return true;
+    }
+    if constexpr (enum_flag_type<E>) {
+      // Combination of flags, e.g. "read|write"
+      if (auto v = enum_flags_cast<E>(*name)) {
+        value = *v;
+        return true;
+      }
+    }
+    return false;
+  }
+  auto underlying = std::underlying_type_t<E>{};
+  if (!read_json_integer(reader, underlying)) {
+    return false;
+  }
+  value = static_cast<E>(underlying);
+  if constexpr (!Options.rejects_invalid_enum) {
+    return true;
+  } else if constexpr (enum_flag_type<E>) {
+    return enum_flags_contains<E>(value);
+  } else {
+    return enum_contains<E>(value);
+  }
+}
+
+template <deserialize_options Options, class... Ts>
+constexpr bool read_json_variant(json_reader& reader, std::variant<Ts...>& value) {
+  // The first alternative that accepts the input wins.
+  // Backtracking restores the structural index cursor as well.
+  if (reader.in_situ && !reader.dry_run) {
+    // Strings are unescaped in place, thus the alternative is selected by a lookahead that
+    // modifies nothing, then read once.
+    template for (constexpr auto I : std::views::iota(0zU, sizeof...(Ts))) {
+      auto lookahead = reader;
+      lookahead.dry_run = true;
+      if (read_json_value<Options>(lookahead, value.template emplace<I>())) {
+        return read_json_value<Options>(reader, value.template emplace<I>());
+      }
+    }
+    return false;
+  }
+  const auto start = reader;
+  template for (constexpr auto I : std::views::iota(0zU, sizeof...(Ts))) {
+    reader = start;
+    if (read_json_value<Options>(reader, value.template emplace<I>())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Constructs a temporary element of container with its allocator if applicable, so that it is moved
+// into container without copying (e.g. std::pmr::string keys of std::pmr::map).
+template <class U, class Container>
+constexpr auto make_json_element(const Container& container) -> U {
+  if constexpr (requires { typename Container::allocator_type; }) {
+    if constexpr (std::uses_allocator_v<U, typename Container::allocator_type>) {
+      return std::make_obj_using_allocator<U>(container.get_allocator());
+    }
+  }
+  return U{};
+}
+
+// Whether keys of std::map are read from JSON object keys: strings, or string views into the
+// input buffer (in-situ only). Consistent with serialize_to_json which checks string_like.
+template <class K>
+constexpr auto is_json_object_key_v =
+    template_instance_of<K, std::basic_string> || std::is_same_v<K, std::string_view>;
+
+// std::map<K, V> where K is string-like type: Deserialized from JSON object
+template <deserialize_options Options, class T>
+constexpr bool read_json_map(json_reader& reader, T& value) {
+  value.clear();
+  if (!reader.consume('{')) {
+    return false;
+  }
+  if (reader.consume('}')) {
+    return true;
+  }
+  do {
+    auto key = make_json_element<typename T::key_type>(value);
+    auto mapped = make_json_element<typename T::mapped_type>(value);
+    if (!read_json_value<Options>(reader, key) || !reader.consume(':')) {
+      return false;
+    }
+    if (!read_json_value<Options>(reader, mapped)) {
+      return false;
+    }
+    if (!reader.dry_run) {
+      value.insert_or_assign(std::move(key), std::move(mapped));
+    }
+  } while (reader.consume(','));
+  return reader.consume('}');
+}
+
+// Elements of associative containers, e.g. std::pair<K, V> for std::unordered_map<K, V>.
+template <class T>
+struct json_range_element {
+  using type = std::ranges::range_value_t<T>;
+};
+
+template <json_mapped_range T>
+struct json_range_element<T> {
+  using type = std::pair<typename T::key_type, typename T::mapped_type>;
+};
+
+// Elements are read directly into the container after emplace_back().
+template <class T>
+concept json_emplace_back_range = json_back_insertable_range<T> && requires(T& range) {
+  { range.back() } -> std::same_as<std::ranges::range_value_t<T>&>;
+};
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_range(json_reader& reader, T& value) {
+  value.clear();
+  if (!reader.consume('[')) {
+    return false;
+  }
+  if (reader.consume(']')) {
+    return true;
+  }
+  do {
+    if (reader.dry_run) {
+      // Elements are validated one by one without being stored.
+      auto elem = make_json_element<typename json_range_element<T>::type>(value);
+      if (!read_json_value<Options>(reader, elem)) return false;
+    } else if constexpr (json_emplace_back_range<T>) {
+      value.emplace_back();
+      if (!read_json_value<Options>(reader, value.back())) return false;
+    } else {
+      // Including std::vector<bool> whose back() is a proxy
+      auto elem = make_json_element<typename json_range_element<T>::type>(value);
+      if (!read_json_value<Options>(reader, elem)) return false;
+      if constexpr (json_back_insertable_range<T>) {
+        value.emplace_back(std::move(elem));
+      } else {
+        value.insert(std::move(elem));
+      }
+    }
+  } while (reader.consume(','));
+  return reader.consume(']');
+}
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_bounded_array(json_reader& reader, T& value) {
+  if (!reader.consume('[')) {
+    return false;
+  }
+  for (auto i = 0zU; i < std::extent_v<T>; i++) {
+    if (i != 0 && !reader.consume(',')) {
+      return false;
+    }
+    if (!read_json_value<Options>(reader, value[i])) {
+      return false;
+    }
+  }
+  return reader.consume(']');
+}
+
+// std::span<T> with dynamic extent
+template <class T>
+constexpr auto is_json_span_v = false;
+
+template <class T>
+constexpr auto is_json_span_v<std::span<T>> = true;
+
+// Elements are counted by a lookahead pass first, so that they are allocated from the arena
+// exactly once.
+template <deserialize_options Options, class T>
+bool read_json_span(json_reader& reader, std::span<T>& value) {
+  using U = std::remove_const_t<T>;
+  auto lookahead = reader;
+  if (!lookahead.consume('[')) {
+    return false;
+  }
+  auto n = 0zU;
+  if (!lookahead.consume(']')) {
+    do {
+      if (!skip_json_value(lookahead)) return false;
+      ++n;
+    } while (lookahead.consume(','));
+    if (!lookahead.consume(']')) {
+      return false;
+    }
+  }
+  if (reader.dry_run) {
+    // Elements are validated one by one without allocation.
+    if (n != 0 && reader.arena == nullptr) {
+      return false;
+    }
+    reader.consume('[');
+    for (auto i = 0zU; i < n; i++) {
+      if (i != 0) {
+        reader.consume(',');
+      }
+      auto element = U{};
+      if (!read_json_value<Options>(reader, element)) {
+        return false;
+      }
+    }
+    reader.consume(']');
+    value = {};
+    return true;
+  }
+  auto* elements = static_cast<U*>(nullptr);
+  if (n != 0) {
+    if (reader.arena == nullptr) {
+      return false;
+    }
+    elements = static_cast<U*>(reader.arena->allocate(n * sizeof(U), alignof(U)));
+    if (elements == nullptr) {
+      return false;
+    }
+    std::uninitialized_value_construct_n(elements, n);
+  }
+  // Punctuation is already validated by lookahead.
+  reader.consume('[');
+  for (auto i = 0zU; i < n; i++) {
+    if (i != 0) {
+      reader.consume(',');
+    }
+    if (!read_json_value<Options>(reader, elements[i])) {
+      return false;
+    }
+  }
+  reader.consume(']');
+  value = std::span<T>{elements, n};
+  return true;
+}
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_tuple(json_reader& reader, T& value) {
+  constexpr auto N = std::tuple_size_v<T>;
+  if (!reader.consume('[')) {
+    return false;
+  }
+  template for (constexpr auto I : std::views::iota(0zU, N)) {
+    if constexpr (I != 0) {
+      if (!reader.consume(',')) return false;
+    }
+    if (!read_json_value<Options>(reader, get_ith_element<I>(value))) {
+      return false;
+    }
+  }
+  return reader.consume(']');
+}
+
+// Member names of T mapped to member indices (as in all_flattened_nonstatic_data_members_v).
+template <class T>
+consteval auto make_struct_json_field_kv_pairs() {
+  using kv_pair_t = std::pair<meta_string_view, size_t>;
+  const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  auto res = std::vector<kv_pair_t>{};
+  res.reserve(std::size(members));
+  for (auto i = 0zU, n = std::size(members); i < n; i++) {
+    auto name = std::meta::identifier_of(members[i].member);
+    res.emplace_back(reflect_cpp26::define_static_string(name), i);
+  }
+  return res;
+}
+
+template <class T>
+consteval auto make_struct_json_field_map() {
+  constexpr auto options = string_key_fixed_map_options{
+      .already_unique = true,
+      .adjusts_alignment = true,
+  };
+  return REFLECT_CPP26_STRING_KEY_FIXED_MAP(make_struct_json_field_kv_pairs<T>(), options);
+}
+
+template <class T>
+constexpr auto struct_json_field_map_v = make_struct_json_field_map<T>();
+
+// Member keys of T with the following colon, i.e. `"name":`. Member names are identifiers,
+// which never contain characters to escape.
+template <class T>
+consteval auto make_struct_json_key_tokens() {
+  const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  auto res = std::vector<meta_string_view>{};
+  res.reserve(std::size(members));
+  for (auto i = 0zU, n = std::size(members); i < n; i++) {
+    auto token = '"' + std::string{std::meta::identifier_of(members[i].member)} + "\":";
+    res.push_back(reflect_cpp26::define_static_string(token));
+  }
+  return reflect_cpp26::define_static_array(res);
+}
+
+template <class T>
+constexpr auto struct_json_key_tokens_v = make_struct_json_key_tokens<T>();
+
+// Longest member name of T, excluding '"', '"' and ':' of the key tokens.
+template <class T>
+consteval auto make_struct_json_max_key_size() -> size_t {
+  auto res = 0zU;
+  for (auto token : struct_json_key_tokens_v<T>) {
+    res = std::max(res, token.size() - 3);
+  }
+  return res;
+}
+
+template <class T>
+constexpr auto struct_json_max_key_size_v = make_struct_json_max_key_size<T>();
+
+template <deserialize_options Options, class T, size_t I>
+constexpr bool read_json_struct_member(json_reader& reader, T& value) {
+  constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  return read_json_value<Options>(reader, value.[:members[I].member:]);
+}
+
+// Readers indexed by member index, so that a member is dispatched with a single fixed map
+// lookup and an indirect call.
+template <deserialize_options Options, class T>
+consteval auto make_struct_json_member_readers() {
+  constexpr auto N = std::size(all_flattened_nonstatic_data_members_v<T>);
+  auto res = std::array<bool (*)(json_reader&, T&), N>{};
+  template for (constexpr auto I : std::views::iota(0zU, N)) {
+    res[I] = read_json_struct_member<Options, T, I>;
+  }
+  return res;
+}
+
+template <deserialize_options Options, class T>
+constexpr auto struct_json_member_readers_v = make_struct_json_member_readers<Options, T>();
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_struct(json_reader& reader, T& value) {
+  constexpr auto N = std::size(all_flattened_nonstatic_data_members_v<T>);
+  constexpr const auto& field_map = struct_json_field_map_v<T>;
+  constexpr const auto& key_tokens = struct_json_key_tokens_v<T>;
+  constexpr const auto& readers = struct_json_member_readers_v<Options, T>;
+  if (!reader.consume('{')) {
+    return false;
+  }
+  auto found = std::array<bool, N>{};
+  auto n_found = 0zU;
+  if (!reader.consume('}')) {
+    auto key_buffer = std::array<char, struct_json_max_key_size_v<T>>{};
+    // Members are predicted to appear in declaration order (as serialize_to_json does), so that
+    // most keys are matched with a single comparison without fixed map lookup.
+    auto expected = 0zU;
+    do {
+      auto index = expected;
+      if (expected >= N || !reader.consume_token(key_tokens[expected])) {
+        auto key = read_json_string_view(reader, key_buffer);
+        if (!key.has_value() || !reader.consume(':')) {
+          return false;
+        }
+        auto found_index = field_map.find(*key);
+        if (!found_index.has_value()) {
+          if (!Options.ignores_unknown_keys || !skip_json_value(reader)) return false;
+          continue;
+        }
+        index = *found_index;
+      }
+      if (!readers[index](reader, value)) {
+        return false;
+      }
+      if constexpr (Options.requires_all_members) {
+        n_found += !std::exchange(found[index], true);
+      }
+      expected = index + 1;
+    } while (reader.consume(','));
+    if (!reader.consume('}')) {
+      return false;
+    }
+  }
+  return !Options.requires_all_members || n_found == N;
+}
+
+// Whether T is a container with polymorphic allocator. Note that std::uses_allocator_v is not
+// used since it holds for std::tuple as well, which has no allocator of its own.
+template <class T>
+constexpr auto is_json_pmr_container_v = false;
+
+template <class T>
+  requires requires { typename T::allocator_type; }
+constexpr auto is_json_pmr_container_v<T> =
+    template_instance_of<typename T::allocator_type, std::pmr::polymorphic_allocator>;
+
+// Rebinds value to reader.resource if T is constructed with polymorphic allocators, so that nested
+// containers allocate from the same resource (elements are constructed with the allocator of
+// their container). Contents of value are to be overwritten anyway.
+template <class T>
+constexpr void rebind_json_memory_resource(json_reader& reader, T& value) {
+  if constexpr (is_json_pmr_container_v<T>) {
+    if (reader.resource != nullptr && value.get_allocator().resource() != reader.resource) {
+      std::destroy_at(&value);
+      std::uninitialized_construct_using_allocator(
+          &value, std::pmr::polymorphic_allocator<>{reader.resource});
+    }
+  }
+}
+
+template <deserialize_options Options, class T>
+constexpr bool read_json_value(json_reader& reader, T& value) {
+  rebind_json_memory_resource(reader, value);
+  if constexpr (std::is_same_v<T, std::monostate>) {
+    // (1) std::monostate
+    return reader.consume_literal("null");
+  } else if constexpr (std::is_same_v<T, bool>) {
+    // (2.1) Boolean
+    if (reader.consume_literal("true")) {
+      value = true;
+      return true;
+    }
+    if (reader.consume_literal("false")) {
+      value = false;
+      return true;
+    }
+    return false;
+  } else if constexpr (char_type<T>) {
+    // (2.2) Character types: integer, or string of exactly one code unit (char_to_string)
+    if (reader.peek() != '"') {
+      return read_json_integer(reader, value);
+    }
+    if (reader.dry_run) {
+      return validate_json_string<T>(reader) == 1zU;
+    }
+    auto str = std::basic_string<T>{};
+    if (!read_json_string(reader, str) || str.size() != 1) {
+      return false;
+    }
+    value = str[0];
+    return true;
+  } else if constexpr (std::is_integral_v<T>) {
+    // (2.3) Integral types
+    return read_json_integer(reader, value);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // (2.4) Floating-point types
+    return read_json_floating_point(reader, value);
+  } else if constexpr (std::is_enum_v<T>) {
+    // (3) Enum types: enumerator name or underlying value
+    return read_json_enum<Options>(reader, value);
+  } else if constexpr (template_instance_of<T, std::basic_string>) {
+    // (4) Strings
+    if (reader.dry_run) {
+      return validate_json_string<typename T::value_type>(reader).has_value();
+    }
+    return read_json_string(reader, value);
+  } else if constexpr (std::is_same_v<T, std::string_view>) {
+    // (4.1) String views into the input buffer (in-situ only)
+    if (reader.dry_run) {
+      value = {};
+      return skip_json_string(reader);
+    }
+    return read_json_string_in_situ(reader, value);
+  } else if constexpr (is_json_span_v<T>) {
+    // (4.2) Spans allocated from the arena (in-situ only)
+    return read_json_span<Options>(reader, value);
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    // (7) std::optional
+    if (reader.consume_literal("null")) {
+      value.reset();
+      return true;
+    }
+    return read_json_value<Options>(reader, value.emplace());
+  } else if constexpr (template_instance_of<T, std::variant>) {
+    // (8) std::variant
+    return read_json_variant<Options>(reader, value);
+  } else if constexpr (template_instance_of<T, std::map>) {
+    if constexpr (is_json_object_key_v<typename T::key_type>) {
+      // (5.1) std::map<K, V> where K is string: Deserialized from JSON object
+      return read_json_map<Options>(reader, value);
+    } else {
+      // (5.2.1) std::map<K, V> where K is not string: Deserialized from JSON nested array
+      return read_json_range<Options>(reader, value);
+    }
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    // (5.2.2) Bounded arrays of exact length
+    return read_json_bounded_array<Options>(reader, value);
+  } else if constexpr (json_back_insertable_range<T> || json_insertable_range<T>) {
+    // (5.2.3) Other containers
+    return read_json_range<Options>(reader, value);
+  } else if constexpr (tuple_like<T>) {
+    // (6) Tuple-like types (including std::array) of exact length
+    return read_json_tuple<Options>(reader, value);
+  } else if constexpr (flattenable_class<T>) {
+    // (9) Flattenable class types (memberwise deserializable)
+    return read_json_struct<Options>(reader, value);
+  } else {
+    static_assert(false, "Invalid or usupported value type");
+  }
+}
+
+// structurals: Buffer of the structural index to reuse, or null to allocate a temporary one.
+template <deserialize_options Options, class T>
+constexpr bool deserialize_json_document(std::string_view json,
+                                         T& value,
+                                         std::pmr::memory_resource* resource = nullptr,
+                                         std::vector<uint32_t>* structurals = nullptr) {
+  auto reader = json_reader{
+      .cur = json.data(),
+      .end = json.data() + json.size(),
+      .resource = resource,
+  };
+  if !consteval {
+    if (json.size() >= json_structural_index_min_size && json.size() <= UINT32_MAX) {
+      auto temp_structurals = std::vector<uint32_t>{};
+      if (structurals == nullptr) {
+        structurals = &temp_structurals;
+      }
+      if (!build_json_structural_index(json, *structurals)) {
+        return false;
+      }
+      reader.begin = json.data();
+      reader.next_structural = structurals->data();
+      reader.last_structural = structurals->data() + structurals->size();
+      return read_json_value<Options>(reader, value) && reader.at_end();
+    }
+  }
+  return read_json_value<Options>(reader, value) && reader.at_end();
+}
+
+// The structural index is not built in in-situ mode, which performs no heap allocation except
+// for values that own memory.
+template <deserialize_options Options, class T>
+bool deserialize_json_document_in_situ(std::span<char> json, T& value, json_arena* arena) {
+  auto reader = json_reader{
+      .cur = json.data(),
+      .end = json.data() + json.size(),
+      .in_situ = true,
+      .arena = arena,
+  };
+  return read_json_value<Options>(reader, value) && reader.at_end();
+}
+}  // namespace impl::json
+
+/**
+ * Deserializes JSON text (UTF-8) into an existing value. Members absent from JSON objects keep
+ * their values (unless Options.requires_all_members is true). Returns false on malformed input
+ * or input not matching type T, in which case dest may be partially modified.
+ */
+template <deserialize_options Options = {}, deserializable T>
+constexpr bool deserialize_from_json(T& dest, std::string_view json) {
+  return impl::json::deserialize_json_document<Options>(json, dest);
+}
+
+/**
+ * Deserializes JSON text (UTF-8) into a value-initialized T.
+ * Returns std::nullopt on malformed input or input not matching type T.
+ */
+template <deserializable T, deserialize_options Options = {}>
+constexpr auto deserialize_from_json(std::string_view json) -> std::optional<T> {
+  auto res = std::optional<T>{std::in_place};
+  if (!impl::json::deserialize_json_document<Options>(json, *res)) {
+    return std::nullopt;
+  }
+  return res;
+}
+
+/**
+ * Deserializes JSON text (UTF-8) into an existing value, where strings and containers with
+ * polymorphic allocators (including nested ones) allocate from resource. Values of such types
+ * that are read from JSON are reconstructed with resource if they use another one.
+ */
+template <deserialize_options Options = {}, deserializable T>
+bool deserialize_from_json(T& dest, std::string_view json, std::pmr::memory_resource* resource) {
+  return impl::json::deserialize_json_document<Options>(json, dest, resource);
+}
+
+// Same as above with the memory resource and the structural index buffer of context.
+template <deserialize_options Options = {}, deserializable T>
+bool deserialize_from_json(T& dest, std::string_view json, json_decode_context& context) {
+  auto& structurals = impl::json::json_decode_context_access::structurals(context);
+  return impl::json::deserialize_json_document<Options>(
+      json, dest, context.resource(), &structurals);
+}
+
+// Deserializes into a value-initialized T with context. Returns std::nullopt on failure.
+template <deserializable T, deserialize_options Options = {}>
+auto deserialize_from_json(std::string_view json, json_decode_context& context)
+    -> std::optional<T> {
+  auto res = std::optional<T>{std::in_place};
+  if (!deserialize_from_json<Options>(*res, json, context)) {
+    return std::nullopt;
+  }
+  return res;
+}
+
+/**
+ * Deserializes JSON text (UTF-8) during constant evaluation, e.g. configuration embedded with
+ * #embed, and converts the result with to_structural so that it can be stored as a constexpr
+ * object (strings and ranges as meta_string_view and meta_span in static storage).
+ * Malformed input or input not matching type T is a compile error.
+ */
+template <deserializable T, deserialize_options Options = {}>
+consteval auto deserialize_from_json_to_structural(std::string_view json) {
+  auto res = T{};
+  if (!impl::json::deserialize_json_document<Options>(json, res)) {
+    compile_error("Malformed JSON input or input not matching type T.");
+  }
+  return to_structural(res);
+}
+
+// Same as above with raw bytes, e.g. `static constexpr unsigned char json[] = {#embed "a.json"};`
+template <deserializable T, deserialize_options Options = {}>
+consteval auto deserialize_from_json_to_structural(std::span<const unsigned char> json) {
+  auto text = std::string(json.begin(), json.end());
+  return deserialize_from_json_to_structural<T, Options>(std::string_view{text});
+}
+
+/**
+ * Deserializes JSON text (UTF-8) in-situ without copying strings: std::string_view values refer
+ * to the input buffer directly, in which strings with escape sequences are unescaped in place
+ * (thus json is modified and must outlive dest). Elements of std::span<T> values are allocated
+ * from arena. Other values are deserialized the same way as deserialize_from_json.
+ * Returns false on malformed input, input not matching type T or insufficient arena storage.
+ */
+template <deserialize_options Options = {}, deserializable_in_situ T>
+bool deserialize_from_json_in_situ(T& dest, std::span<char> json, json_arena& arena) {
+  return impl::json::deserialize_json_document_in_situ<Options>(json, dest, &arena);
+}
+
+// Same as above without arena, where std::span<T> values accept empty arrays only.
+template <deserialize_options Options = {}, deserializable_in_situ T>
+bool deserialize_from_json_in_situ(T& dest, std::span<char> json) {
+  return impl::json::deserialize_json_document_in_situ<Options>(json, dest, nullptr);
+}
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_HPP
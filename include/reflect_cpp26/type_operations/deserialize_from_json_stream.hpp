@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_STREAM_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_STREAM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <reflect_cpp26/type_operations/deserialize_from_json.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace reflect_cpp26 {
+/**
+ * Push-style deserializer of a stream of JSON values (e.g. NDJSON records or concatenated
+ * documents) received in chunks of arbitrary sizes. Chunks may split values anywhere, including
+ * in the middle of tokens, escape sequences and UTF-8 sequences. Each top-level value is
+ * deserialized and handed over to the handler as soon as it is complete. Only the incomplete
+ * value at the end of the last chunk is buffered across feed() calls.
+ */
+template <deserializable T, deserialize_options Options = {}>
+class json_stream_deserializer {
+public:
+  using handler_type = std::function<void(T&&)>;
+
+  explicit json_stream_deserializer(handler_type handler) : handler_(std::move(handler)) {}
+
+  /**
+   * Consumes a chunk, during which the handler is invoked with each completed value.
+   * Returns false if the stream is malformed, after which feed() and finish() keep failing until
+   * reset() is called.
+   */
+  bool feed(std::span<const char> chunk) {
+    if (state_ == state::failed) {
+      return false;
+    }
+    // [first, p) is the part of current value in this chunk.
+    const auto* first = chunk.data();
+    const auto* p = first;
+    const auto* end = first + chunk.size();
+    while (p < end) {
+      switch (state_) {
+        case state::between_values:
+          for (; p < end && impl::json::is_json_whitespace(*p); ++p) {}
+          if (p == end) {
+            break;
+          }
+          first = p;
+          if (!begin_value(*p++)) {
+            return false;
+          }
+          break;
+        case state::in_string:
+          for (; p < end && *p != '"' && *p != '\\'; ++p) {}
+          if (p < end) {
+            state_ = (*p++ == '"') ? state::in_container : state::in_string_escape;
+            if (state_ == state::in_container && depth_ == 0 && !complete_value(first, p)) {
+              return false;
+            }
+          }
+          break;
+        case state::in_string_escape:
+          // The escaped character is validated by the deserializer.
+          ++p;
+          state_ = state::in_string;
+          break;
+        case state::in_container:
+          for (; p < end && depth_ != 0; ++p) {
+            if (*p == '"') {
+              state_ = state::in_string;
+              ++p;
+              break;
+            }
+            if (*p == '{' || *p == '[') {
+              ++depth_;
+            } else if ((*p == '}' || *p == ']') && --depth_ == 0 && !complete_value(first, p + 1)) {
+              return false;
+            }
+          }
+          break;
+        case state::in_scalar:
+          for (; p < end && !ends_scalar(*p); ++p) {}
+          if (p < end && !complete_value(first, p)) {
+            return false;
+          }
+          break;
+        default:
+          REFLECT_CPP26_UNREACHABLE("Invalid state");
+      }
+      if (state_ == state::between_values) {
+        first = p;
+      }
+    }
+    if (state_ != state::between_values) {
+      buffer_.append(first, end);
+    }
+    return true;
+  }
+
+  /**
+   * Ends the stream, completing the last value if it is a number or literal (which is otherwise
+   * terminated by the following whitespace or value only). Returns false if the stream is
+   * malformed or ends within a value.
+   */
+  bool finish() {
+    if (state_ == state::in_scalar) {
+      return complete_value(nullptr, nullptr);
+    }
+    return state_ == state::between_values;
+  }
+
+  // Discards buffered input and clears the failed state.
+  void reset() {
+    state_ = state::between_values;
+    depth_ = 0;
+    buffer_.clear();
+  }
+
+  // Number of values handed over to the handler so far.
+  auto count() const -> size_t {
+    return count_;
+  }
+
+private:
+  enum class state : uint8_t {
+    between_values,
+    in_container,  // Outside strings of a top-level array or object
+    in_string,
+    in_string_escape,
+    in_scalar,  // Top-level number or literal
+    failed,
+  };
+
+  static constexpr bool ends_scalar(char c) {
+    return impl::json::is_json_whitespace(c) || c == '"' || c == '{' || c == '}' || c == '['
+           || c == ']' || c == ',' || c == ':';
+  }
+
+  bool begin_value(char c) {
+    switch (c) {
+      case '"':
+        state_ = state::in_string;
+        return true;
+      case '{':
+      case '[':
+        state_ = state::in_container;
+        depth_ = 1;
+        return true;
+      case '}':
+      case ']':
+        state_ = state::failed;
+        return false;
+      default:
+        state_ = state::in_scalar;
+        return true;
+    }
+  }
+
+  // Deserializes the buffered part of current value followed by [first, last).
+  bool complete_value(const char* first, const char* last) {
+    auto json = std::string_view{first, last};
+    if (!buffer_.empty()) {
+      buffer_.append(first, last);
+      json = buffer_;
+    }
+    auto value = deserialize_from_json<T, Options>(json);
+    buffer_.clear();
+    depth_ = 0;
+    if (!value.has_value()) {
+      state_ = state::failed;
+      return false;
+    }
+    state_ = state::between_values;
+    count_ += 1;
+    handler_(std::move(*value));
+    return true;
+  }
+
+  handler_type handler_;
+  std::string buffer_;
+  size_t depth_ = 0;
+  size_t count_ = 0;
+  state state_ = state::between_values;
+};
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_DESERIALIZE_FROM_JSON_STREAM_HPP
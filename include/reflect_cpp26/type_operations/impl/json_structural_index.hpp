@@ -0,0 +1,268 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_IMPL_JSON_STRUCTURAL_INDEX_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_IMPL_JSON_STRUCTURAL_INDEX_HPP
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Stage one of JSON parsing: a vectorized pass that locates all structural characters, so that
+// stage two (typed materialization) never scans whitespaces or string contents byte by byte.
+namespace reflect_cpp26::impl::json {
+constexpr auto json_block_size = 64zU;
+
+// Bit i of each mask corresponds to byte i of a 64-byte block.
+struct json_block_masks {
+  uint64_t backslash;
+  uint64_t quote;
+  uint64_t op;          // {}[]:,
+  uint64_t whitespace;  // ' ', '\t', '\n' and '\r'
+  uint64_t control;     // 0x00 to 0x1F
+};
+
+constexpr uint8_t json_backslash_class = 1u;
+constexpr uint8_t json_quote_class = 2u;
+constexpr uint8_t json_op_class = 4u;
+constexpr uint8_t json_whitespace_class = 8u;
+constexpr uint8_t json_control_class = 16u;
+
+constexpr auto json_char_class_table = []() {
+  auto res = std::array<uint8_t, 256>{};
+  for (auto c = 0; c < 0x20; c++) {
+    res[c] = json_control_class;
+  }
+  for (auto c : {' ', '\t', '\n', '\r'}) {
+    res[c] |= json_whitespace_class;
+  }
+  for (auto c : {'{', '}', '[', ']', ':', ','}) {
+    res[c] = json_op_class;
+  }
+  res['\\'] = json_backslash_class;
+  res['"'] = json_quote_class;
+  return res;
+}();
+
+inline auto classify_json_block_scalar(const char* block) -> json_block_masks {
+  auto res = json_block_masks{};
+  for (auto i = 0zU; i < json_block_size; i++) {
+    auto c = json_char_class_table[static_cast<unsigned char>(block[i])];
+    res.backslash |= static_cast<uint64_t>((c & json_backslash_class) != 0) << i;
+    res.quote |= static_cast<uint64_t>((c & json_quote_class) != 0) << i;
+    res.op |= static_cast<uint64_t>((c & json_op_class) != 0) << i;
+    res.whitespace |= static_cast<uint64_t>((c & json_whitespace_class) != 0) << i;
+    res.control |= static_cast<uint64_t>((c & json_control_class) != 0) << i;
+  }
+  return res;
+}
+
+#if defined(__AVX2__)
+// 64-byte block as 2 lanes of 32 bytes
+struct json_simd_block {
+  __m256i lanes[2];
+
+  explicit json_simd_block(const char* block) {
+    lanes[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    lanes[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+  }
+
+  template <class CompareFn>
+  auto to_mask(CompareFn compare) const -> uint64_t {
+    auto lo = static_cast<uint32_t>(_mm256_movemask_epi8(compare(lanes[0])));
+    auto hi = static_cast<uint32_t>(_mm256_movemask_epi8(compare(lanes[1])));
+    return lo | (static_cast<uint64_t>(hi) << 32);
+  }
+
+  auto eq(char c) const -> uint64_t {
+    auto v = _mm256_set1_epi8(c);
+    return to_mask([v](__m256i lane) { return _mm256_cmpeq_epi8(lane, v); });
+  }
+
+  // (byte | 0x20) == c
+  auto eq_lower(char c) const -> uint64_t {
+    auto v = _mm256_set1_epi8(c);
+    auto bit = _mm256_set1_epi8(0x20);
+    return to_mask([v, bit](__m256i lane) {
+      return _mm256_cmpeq_epi8(_mm256_or_si256(lane, bit), v);
+    });
+  }
+
+  // Unsigned comparison: byte <= c
+  auto le(char c) const -> uint64_t {
+    auto v = _mm256_set1_epi8(c);
+    return to_mask([v](__m256i lane) { return _mm256_cmpeq_epi8(_mm256_max_epu8(lane, v), v); });
+  }
+};
+#elif defined(__SSE2__)
+// 64-byte block as 4 lanes of 16 bytes
+struct json_simd_block {
+  __m128i lanes[4];
+
+  explicit json_simd_block(const char* block) {
+    for (auto i = 0; i < 4; i++) {
+      lanes[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+    }
+  }
+
+  template <class CompareFn>
+  auto to_mask(CompareFn compare) const -> uint64_t {
+    auto res = uint64_t{0};
+    for (auto i = 0; i < 4; i++) {
+      auto m = static_cast<uint32_t>(_mm_movemask_epi8(compare(lanes[i])));
+      res |= static_cast<uint64_t>(m) << (i * 16);
+    }
+    return res;
+  }
+
+  auto eq(char c) const -> uint64_t {
+    auto v = _mm_set1_epi8(c);
+    return to_mask([v](__m128i lane) { return _mm_cmpeq_epi8(lane, v); });
+  }
+
+  // (byte | 0x20) == c
+  auto eq_lower(char c) const -> uint64_t {
+    auto v = _mm_set1_epi8(c);
+    auto bit = _mm_set1_epi8(0x20);
+    return to_mask([v, bit](__m128i lane) { return _mm_cmpeq_epi8(_mm_or_si128(lane, bit), v); });
+  }
+
+  // Unsigned comparison: byte <= c
+  auto le(char c) const -> uint64_t {
+    auto v = _mm_set1_epi8(c);
+    return to_mask([v](__m128i lane) { return _mm_cmpeq_epi8(_mm_max_epu8(lane, v), v); });
+  }
+};
+#endif
+
+inline auto classify_json_block(const char* block) -> json_block_masks {
+#if defined(__AVX2__) || defined(__SSE2__)
+  auto simd = json_simd_block{block};
+  return {
+      .backslash = simd.eq('\\'),
+      .quote = simd.eq('"'),
+      // '[' | 0x20 == '{' and ']' | 0x20 == '}'
+      .op = simd.eq_lower('{') | simd.eq_lower('}') | simd.eq(':') | simd.eq(','),
+      .whitespace = simd.eq(' ') | simd.eq('\t') | simd.eq('\n') | simd.eq('\r'),
+      .control = simd.le(0x1F),
+  };
+#else
+  return classify_json_block_scalar(block);
+#endif
+}
+
+// Bit i of the result is the parity of bits 0 to i of x.
+constexpr auto prefix_xor(uint64_t x) -> uint64_t {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+// Carries states of string and scalar detection across blocks.
+struct json_structural_scanner {
+  uint64_t escapes_next_block = 0;  // 1 if the first byte of next block is escaped
+  uint64_t in_string = 0;           // All ones if next block starts inside a string
+  uint64_t in_scalar = 0;           // 1 if last byte of previous block belongs to a scalar
+  uint64_t errors = 0;
+
+  // Bytes following an unescaped backslash. Backslash runs are rare in practice.
+  constexpr auto find_escaped(uint64_t backslash) -> uint64_t {
+    auto escaped = escapes_next_block;
+    backslash &= ~escapes_next_block;
+    escapes_next_block = 0;
+    while (backslash != 0) {
+      auto i = std::countr_zero(backslash);
+      if (i == 63) {
+        escapes_next_block = 1;
+        break;
+      }
+      escaped |= uint64_t{2} << i;
+      backslash &= ~(uint64_t{3} << i);
+    }
+    return escaped;
+  }
+
+  // Returns the mask of structural bytes in current block: operators outside strings, all
+  // unescaped quotes (i.e. both ends of each string) and the first byte of each scalar.
+  constexpr auto next(const json_block_masks& masks) -> uint64_t {
+    auto quote = masks.quote & ~find_escaped(masks.backslash);
+    // Opening quotes and string contents, excluding closing quotes
+    auto string_mask = prefix_xor(quote) ^ in_string;
+    in_string = static_cast<uint64_t>(static_cast<int64_t>(string_mask) >> 63);
+    errors |= masks.control & string_mask;  // Unescaped control characters in strings
+
+    auto op = masks.op & ~string_mask;
+    auto scalar = ~(string_mask | quote | masks.op | masks.whitespace);
+    auto scalar_start = scalar & ~((scalar << 1) | in_scalar);
+    in_scalar = scalar >> 63;
+    return op | quote | scalar_start;
+  }
+};
+
+/**
+ * Builds the structural index of JSON text: ascending offsets of operators {}[]:, outside
+ * strings, unescaped quotes and the first byte of each scalar (number, true, false or null).
+ * Returns false if any string is unterminated or contains unescaped control characters.
+ * Other errors are left to stage two.
+ * Precondition: json.size() <= UINT32_MAX.
+ */
+inline bool build_json_structural_index(std::string_view json, std::vector<uint32_t>& positions) {
+  // Each byte is at most one structural.
+  positions.resize(json.size());
+  auto* out = positions.data();
+  auto scanner = json_structural_scanner{};
+  auto append_block = [&scanner, &out](const char* block, uint32_t offset) {
+    for (auto structurals = scanner.next(classify_json_block(block)); structurals != 0;
+         structurals &= structurals - 1) {
+      *out++ = offset + std::countr_zero(structurals);
+    }
+  };
+
+  auto n = json.size();
+  auto i = 0zU;
+  for (; i + json_block_size <= n; i += json_block_size) {
+    append_block(json.data() + i, i);
+  }
+  if (i < n) {
+    // The last partial block is padded with whitespaces.
+    char block[json_block_size];
+    std::memset(block, ' ', json_block_size);
+    std::memcpy(block, json.data() + i, n - i);
+    append_block(block, i);
+  }
+  positions.resize(out - positions.data());
+  return scanner.errors == 0 && scanner.in_string == 0;
+}
+}  // namespace reflect_cpp26::impl::json
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_IMPL_JSON_STRUCTURAL_INDEX_HPP
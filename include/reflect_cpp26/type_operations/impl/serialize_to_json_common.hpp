@@ -28,6 +28,51 @@
 #include <reflect_cpp26/utils/string_builder.hpp>
 
 namespace reflect_cpp26::impl::json {
+// Long strings are escaped chunk by chunk so that every reservation stays bounded, which keeps
+// builders with a flush handler within their buffer size.
+constexpr auto json_string_chunk_size = 512zU;
+
+// Chunks never split a UTF-8 or UTF-16 multi-unit sequence.
+template <class InputCharT>
+constexpr auto json_string_chunk_end(const InputCharT* begin, const InputCharT* end)
+    -> const InputCharT* {
+  if (static_cast<size_t>(end - begin) <= json_string_chunk_size) {
+    return end;
+  }
+  auto* res = begin + json_string_chunk_size;
+  if constexpr (sizeof(InputCharT) == 1) {
+    for (auto i = 0; i < 3 && (static_cast<uint8_t>(*res) & 0xC0) == 0x80; i++) {
+      --res;  // At most 3 continuation bytes in a valid code point
+    }
+  } else if constexpr (sizeof(InputCharT) == 2) {
+    if (is_low_surrogate(static_cast<char16_t>(*res))) {
+      --res;
+    }
+  }
+  return res;
+}
+
+template <class CharT, class Allocator, class InputCharT>
+constexpr void append_json_string(basic_string_builder<CharT, Allocator>& dest,
+                                  std::basic_string_view<InputCharT> str) {
+  if (str.length() <= json_string_chunk_size) [[likely]] {
+    dest.reserve_at_least(6 * str.length() + 2)  // 6 : Max length of escaped character
+        .append_char_unsafe('"')
+        .append_utf_string_json_escaped_unsafe(str)
+        .append_char_unsafe('"');
+    return;
+  }
+  dest.append_char('"');
+  const auto* end = str.data() + str.length();
+  for (const auto* cur = str.data(); cur < end;) {
+    const auto* chunk_end = json_string_chunk_end(cur, end);
+    dest.reserve_at_least(6 * (chunk_end - cur))
+        .append_utf_string_json_escaped_unsafe(cur, chunk_end);
+    cur = chunk_end;
+  }
+  dest.append_char('"');
+}
+
 template <class Derived>
 struct indented_serializer_base {
   template <class CharT, class Allocator, class T>
@@ -79,18 +124,17 @@ struct indented_serializer_base {
       auto key_sv = make_string_view(k);
       if (is_first) {
         is_first = false;
-        dest.reserve_at_least(indent_level + 6 * key_sv.length() + 5)
+        dest.reserve_at_least(indent_level + 1)
             .append_char_unsafe('\n')
             .append_char_unsafe(indent_char, indent_level);
       } else {
-        dest.reserve_at_least(indent_level + 6 * key_sv.length() + 6)
-            .append_char_unsafe(',')   // +1
-            .append_char_unsafe('\n')  // +1
+        dest.reserve_at_least(indent_level + 2)
+            .append_char_unsafe(',')
+            .append_char_unsafe('\n')
             .append_char_unsafe(indent_char, indent_level);
       }
-      dest.append_char_unsafe('"')  // +1
-          .append_utf_string_json_escaped_unsafe(key_sv)
-          .append_c_string_unsafe("\": ");  // +3: '"', ':' and ' '
+      append_json_string(dest, key_sv);
+      dest.append_c_string(": ");
       if (!Derived::operator()(dest, v, indent_level, indent_size, indent_char)) [[unlikely]] {
         return false;
       }
@@ -165,13 +209,11 @@ struct unindented_serializer_base {
       auto key_sv = make_string_view(k);
       if (is_first) {
         is_first = false;
-        dest.reserve_at_least(6 * key_sv.length() + 3);
       } else {
-        dest.reserve_at_least(6 * key_sv.length() + 4).append_char_unsafe(',');  // +1
+        dest.append_char(',');
       }
-      dest.append_char_unsafe('"')  // +1
-          .append_utf_string_json_escaped_unsafe(k)
-          .append_c_string_unsafe("\":");  // +2: '"' and ':'
+      append_json_string(dest, key_sv);
+      dest.append_char(':');
       if (!Derived::operator()(dest, v)) [[unlikely]] {
         return false;
       }
@@ -0,0 +1,284 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_JSON_DOCUMENT_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_JSON_DOCUMENT_HPP
+
+#include <algorithm>
+#include <optional>
+#include <ranges>
+#include <reflect_cpp26/type_operations/deserialize_from_json.hpp>
+#include <reflect_cpp26/utils/ctype.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_span.hpp>
+#include <reflect_cpp26/utils/meta_string_view.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace reflect_cpp26 {
+/**
+ * Lazy view of a JSON document (UTF-8), which is parsed on demand by get() along the requested
+ * path only. The referenced text must outlive the document and its sub-documents.
+ */
+class json_document {
+public:
+  constexpr json_document() = default;
+
+  explicit constexpr json_document(std::string_view json) : json_(json) {}
+
+  constexpr auto text() const -> std::string_view {
+    return json_;
+  }
+
+private:
+  std::string_view json_;
+};
+
+// Dot-separated JSON path as template argument, e.g. "user.id" or "items.0.name", where
+// segments of digits index arrays as well. An empty path refers to the whole document.
+template <size_t N>
+struct json_path_literal {
+  char chars[N];
+
+  consteval json_path_literal(const char (&path)[N]) {
+    std::ranges::copy(path, chars);
+  }
+
+  constexpr auto view() const -> std::string_view {
+    return {chars, N - 1};
+  }
+};
+
+namespace impl::json {
+struct json_path_segment {
+  meta_string_view key;
+  // Index of array element if key consists of digits only, or SIZE_MAX otherwise.
+  size_t index;
+};
+
+consteval auto make_json_path_segment(std::string_view key) -> json_path_segment {
+  if (key.empty()) {
+    compile_error("Empty segment in JSON path.");
+  }
+  auto res = json_path_segment{.key = reflect_cpp26::define_static_string(key), .index = 0};
+  if (!std::ranges::all_of(key, ascii_isdigit)) {
+    res.index = SIZE_MAX;
+    return res;
+  }
+  for (auto c : key) {
+    res.index = res.index * 10 + (c - '0');
+  }
+  return res;
+}
+
+consteval auto make_json_path_segments(std::string_view path) -> meta_span<json_path_segment> {
+  auto res = std::vector<json_path_segment>{};
+  if (!path.empty()) {
+    for (auto key : path | std::views::split('.')) {
+      res.push_back(make_json_path_segment(std::string_view{key}));
+    }
+  }
+  return reflect_cpp26::define_static_array(res);
+}
+
+template <json_path_literal Path>
+constexpr auto json_path_segments_v = make_json_path_segments(Path.view());
+
+// Each member must belong to the type of its predecessor (or a base class of it).
+template <std::meta::info... Members>
+consteval auto make_json_member_path_segments() -> meta_span<json_path_segment> {
+  auto res = std::vector<json_path_segment>{};
+  auto parent = std::meta::info{};
+  for (auto member : {Members...}) {
+    if (!is_nonstatic_data_member(member)) {
+      compile_error("JSON path segments must be non-static data members.");
+    }
+    if (parent != std::meta::info{} && parent != parent_of(member)
+        && !is_base_of_type(parent_of(member), parent)) {
+      compile_error("JSON path segment is not a member of its predecessor.");
+    }
+    res.push_back(make_json_path_segment(identifier_of(member)));
+    parent = remove_cvref(type_of(member));
+  }
+  return reflect_cpp26::define_static_array(res);
+}
+
+template <std::meta::info... Members>
+constexpr auto json_member_path_segments_v = make_json_member_path_segments<Members...>();
+
+// Skips a value without validation, tracking only quotes, escape sequences and brackets.
+// Returns false if input ends within the value.
+constexpr bool skip_json_value_unchecked(json_reader& reader) {
+  reader.skip_whitespace();
+  const auto* p = reader.cur;
+  const auto* end = reader.end;
+  auto depth = 0zU;
+  do {
+    if (p == end) {
+      return false;
+    }
+    switch (*p) {
+      case '"': {
+        // The closing quote is the first one preceded by an even number of backslashes.
+        const auto* content = ++p;
+        while (true) {
+          p = std::char_traits<char>::find(p, end - p, '"');
+          if (p == nullptr) {
+            return false;
+          }
+          const auto* backslashes = p;
+          for (; backslashes > content && backslashes[-1] == '\\'; --backslashes) {}
+          if ((p++ - backslashes) % 2 == 0) {
+            break;
+          }
+        }
+        break;
+      }
+      case '{':
+      case '[':
+        ++depth;
+        ++p;
+        break;
+      case '}':
+      case ']':
+        if (depth == 0) {
+          return false;
+        }
+        --depth;
+        ++p;
+        break;
+      default:
+        if (depth == 0) {
+          // Scalar outside containers
+          for (; p < end && *p != ',' && *p != '}' && *p != ']' && !is_json_whitespace(*p); ++p) {}
+          if (p == reader.cur) {
+            return false;
+          }
+        } else {
+          for (++p; p < end && *p != '"' && *p != '{' && *p != '}' && *p != '[' && *p != ']'; ++p) {
+          }
+        }
+        break;
+    }
+  } while (depth != 0);
+  reader.cur = p;
+  return true;
+}
+
+// Precondition: '{' is consumed. Moves to the value of the first member with given key.
+constexpr bool find_json_member(json_reader& reader, std::string_view key) {
+  if (reader.peek() == '}') {
+    return false;
+  }
+  auto key_buffer = std::string{};
+  do {
+    auto cur_key = read_json_string_view(reader, key_buffer);
+    if (!cur_key.has_value() || !reader.consume(':')) {
+      return false;
+    }
+    if (*cur_key == key) {
+      return true;
+    }
+    if (!skip_json_value_unchecked(reader)) {
+      return false;
+    }
+  } while (reader.consume(','));
+  return false;
+}
+
+// Precondition: '[' is consumed. Moves to the element of given index.
+constexpr bool find_json_element(json_reader& reader, size_t index) {
+  if (reader.peek() == ']') {
+    return false;
+  }
+  for (auto i = 0zU; i < index; i++) {
+    if (!skip_json_value_unchecked(reader) || !reader.consume(',')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <deserialize_options Options, class T>
+constexpr auto get_json_path(std::string_view json, meta_span<json_path_segment> path)
+    -> std::optional<T> {
+  auto reader = json_reader{.cur = json.data(), .end = json.data() + json.size()};
+  for (const auto& segment : path) {
+    if (reader.consume('{')) {
+      if (!find_json_member(reader, segment.key)) return std::nullopt;
+    } else if (reader.consume('[')) {
+      if (segment.index == SIZE_MAX || !find_json_element(reader, segment.index)) {
+        return std::nullopt;
+      }
+    } else {
+      return std::nullopt;
+    }
+  }
+  if constexpr (std::is_same_v<T, json_document>) {
+    reader.skip_whitespace();
+    const auto* first = reader.cur;
+    if (!skip_json_value_unchecked(reader)) {
+      return std::nullopt;
+    }
+    return json_document{std::string_view{first, reader.cur}};
+  } else {
+    auto res = std::optional<T>{std::in_place};
+    if (!read_json_value<Options>(reader, *res)) {
+      return std::nullopt;
+    }
+    return res;
+  }
+}
+}  // namespace impl::json
+
+template <class T>
+concept json_document_value = deserializable<T> || std::is_same_v<T, json_document>;
+
+/**
+ * Gets the value at given path of a lazy JSON document, e.g. get<"user.id", int64_t>(doc).
+ * Path segments are split at compile time. Only the values along the path are scanned (without
+ * validation), and subtrees of other keys are skipped by a quote and bracket aware scanner. The
+ * value at the path is deserialized the same way as deserialize_from_json<T, Options>, or
+ * referred to as a sub-document if T is json_document.
+ * Returns std::nullopt if the path is absent, or the value at the path does not match T.
+ * The first one wins if duplicated keys are present.
+ */
+template <json_path_literal Path, json_document_value T, deserialize_options Options = {}>
+constexpr auto get(const json_document& doc) -> std::optional<T> {
+  return impl::json::get_json_path<Options, T>(doc.text(), impl::json::json_path_segments_v<Path>);
+}
+
+/**
+ * Same as above, where path is given by reflections of non-static data members, e.g.
+ * get<^^event_t::user, ^^user_t::id>(doc), and T is the type of the last member.
+ */
+template <std::meta::info... Members>
+  requires(sizeof...(Members) > 0)
+constexpr auto get(const json_document& doc) {
+  using T = [:remove_cvref(type_of(Members...[sizeof...(Members) - 1])):];
+  return impl::json::get_json_path<deserialize_options{}, T>(
+      doc.text(), impl::json::json_member_path_segments_v<Members...>);
+}
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_JSON_DOCUMENT_HPP
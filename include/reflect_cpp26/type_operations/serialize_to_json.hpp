@@ -23,17 +23,31 @@
 #ifndef REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_HPP
 #define REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_HPP
 
+#include <cstdio>
+#include <functional>
+#include <limits>
 #include <map>
 #include <optional>
+#include <ostream>
 #include <reflect_cpp26/enum/enum_contains.hpp>
 #include <reflect_cpp26/enum/enum_flags_name.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
 #include <reflect_cpp26/enum/enum_name.hpp>
+#include <reflect_cpp26/enum/impl/enum_unique_entries.hpp>
 #include <reflect_cpp26/type_operations/impl/serialize_to_json_common.hpp>
 #include <reflect_cpp26/type_traits/enum_types.hpp>
 #include <reflect_cpp26/type_traits/serializable_types.hpp>
 #include <reflect_cpp26/type_traits/template_instance.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
 #include <reflect_cpp26/utils/string_utility.hpp>
+#include <span>
 #include <variant>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+#include <unistd.h>
+#endif
 
 namespace reflect_cpp26 {
 struct serialize_options {
@@ -47,6 +61,44 @@ struct serialize_options {
   }
 };
 
+struct json_stream_options {
+  // Capacity of the bounded output buffer, which is flushed to the sink whenever it is full.
+  // Values below json_stream_min_buffer_size are rounded up.
+  size_t buffer_size = 65536;
+};
+
+constexpr auto json_stream_min_buffer_size = 8192zU;
+
+#if __has_include(<unistd.h>)
+// POSIX file descriptor as JSON output sink. Not an aggregate, so that it is never mistaken for
+// a serializable value.
+class fd_sink {
+public:
+  explicit constexpr fd_sink(int fd) : fd_(fd) {}
+
+  constexpr int fd() const {
+    return fd_;
+  }
+
+private:
+  int fd_;
+};
+#endif
+
+// Output sinks of streamed serialization:
+// (1) Invocable with std::basic_string_view<CharT>. Returning false reports a write failure;
+// (2) fd_sink (POSIX only);
+// (3) FILE*;
+// (4) std::basic_ostream<CharT> and its derived classes.
+template <class Sink, class CharT>
+concept json_output_sink =
+#if __has_include(<unistd.h>)
+    std::is_same_v<std::remove_cvref_t<Sink>, fd_sink> ||
+#endif
+    std::is_same_v<std::decay_t<Sink>, std::FILE*>
+    || std::is_base_of_v<std::basic_ostream<CharT>, std::remove_cvref_t<Sink>>
+    || std::is_invocable_v<Sink&, std::basic_string_view<CharT>>;
+
 namespace impl::json {
 template <bool ToString, class CharT, class Allocator, class T>
 static constexpr void serialize_char(basic_string_builder<CharT, Allocator>& dest, T value) {
@@ -83,10 +135,90 @@ static constexpr bool serialize_floating_point(basic_string_builder<CharT, Alloc
   return true;
 }
 
+// Precomputed JSON string tokens, where the i-th token is pool[offsets[i], offsets[i + 1]).
+template <class CharT>
+struct json_token_table {
+  meta_basic_string_view<CharT> pool;
+  meta_span<uint32_t> offsets;
+
+  constexpr auto get(size_t i) const -> std::basic_string_view<CharT> {
+    if (i >= offsets.size() - 1) {
+      return {};
+    }
+    return {pool.data() + offsets[i], pool.data() + offsets[i + 1]};
+  }
+
+  constexpr auto max_length() const -> size_t {
+    auto res = 0zU;
+    for (auto i = 1zU; i < offsets.size(); i++) {
+      res = std::max<size_t>(res, offsets[i] - offsets[i - 1]);
+    }
+    return res;
+  }
+};
+
+template <class CharT, class AppendFunc>
+consteval auto make_json_token_table(size_t n, AppendFunc append_token)
+    -> json_token_table<CharT> {
+  auto pool = basic_string_builder<CharT>{};
+  auto offsets = std::vector<uint32_t>{0};
+  offsets.reserve(n + 1);
+  for (auto i = 0zU; i < n; i++) {
+    append_token(pool, i);
+    offsets.push_back(static_cast<uint32_t>(pool.size()));
+  }
+  return {reflect_cpp26::define_static_string(pool.strview()),
+          reflect_cpp26::define_static_array(offsets)};
+}
+
+// Quoted and escaped names of enum values. Empty token indicates an invalid value.
+template <class CharT, class NameFunc>
+consteval auto make_enum_json_token_table(size_t n, NameFunc name_of)
+    -> json_token_table<CharT> {
+  return make_json_token_table<CharT>(n, [name_of](basic_string_builder<CharT>& pool, size_t i) {
+    if (auto name = name_of(i); name.has_value()) {
+      pool.append_char('"').append_utf_string_json_escaped(*name).append_char('"');
+    }
+  });
+}
+
+// Indexed by enum_unique_index.
+template <class CharT, class E>
+constexpr auto enum_json_token_table_v = make_enum_json_token_table<CharT>(
+    enum_unique_count_v<E>, [](size_t i) -> std::optional<std::string_view> {
+      return enum_name(enum_unique_values_array_v<E>[i]);
+    });
+
+// Indexed by underlying value of flags. Available if enum_flags_has_name_table_v<E>.
+template <class CharT, class E>
+constexpr auto enum_flags_json_token_table_v = make_enum_json_token_table<CharT>(
+    enum_flags_name_table_v<E>.offsets.size() - 1, [](size_t v) {
+      return enum_flags_name_from_table(static_cast<E>(v));
+    });
+
+template <bool HaltsOnInvalid, class CharT, class Allocator>
+constexpr bool append_enum_json_token(basic_string_builder<CharT, Allocator>& dest,
+                                      std::basic_string_view<CharT> token) {
+  if (!token.empty()) [[likely]] {
+    dest.append_string(token);
+    return true;
+  } else if constexpr (HaltsOnInvalid) {
+    return false;
+  } else {
+    dest.append_c_string("null");
+    return true;
+  }
+}
+
 template <bool HaltsOnInvalid, class CharT, class Allocator, class T>
 constexpr bool stringify_enum_flag(basic_string_builder<CharT, Allocator>& dest, T value) {
-  if constexpr (std::is_same_v<CharT, char>) {
-    dest.append_char('"');
+  if constexpr (enum_flags_has_name_table_v<T>) {
+    auto token = enum_flags_json_token_table_v<CharT, T>.get(unsigned_promoted(value));
+    return append_enum_json_token<HaltsOnInvalid>(dest, token);
+  } else if constexpr (std::is_same_v<CharT, char>
+                       && enum_flags_name_max_length<T>(1) + 2 <= json_stream_min_buffer_size) {
+    // Reserved in advance so that the opening quote is never flushed before being unwound.
+    dest.reserve_at_least(enum_flags_name_max_length<T>(1) + 2).append_char_unsafe('"');
     if (enum_flags_name_to(dest, value) == to_string_status::done) [[likely]] {
       dest.append_char('"');
     } else {
@@ -101,7 +233,9 @@ constexpr bool stringify_enum_flag(basic_string_builder<CharT, Allocator>& dest,
     auto str = enum_flags_name(value);
 
     if (str.has_value()) [[likely]] {
-      if constexpr (enum_names_are_ascii_only_v<T>) {
+      if (str->length() > json_string_chunk_size) [[unlikely]] {
+        append_json_string(dest, std::string_view{*str});  // Written in bounded chunks
+      } else if constexpr (enum_names_are_ascii_only_v<T>) {
         dest.reserve_at_least(str->length() + 2)
             .append_char_unsafe('"')
             .append_c_string_unsafe(*str)
@@ -123,27 +257,8 @@ constexpr bool stringify_enum_flag(basic_string_builder<CharT, Allocator>& dest,
 
 template <bool HaltsOnInvalid, class CharT, class Allocator, class T>
 constexpr bool stringify_enum(basic_string_builder<CharT, Allocator>& dest, T value) {
-  auto str = enum_name(value);
-
-  if (!str.empty()) [[likely]] {
-    if constexpr (enum_names_are_ascii_only_v<T>) {
-      dest.reserve_at_least(str.length() + 2)
-          .append_char_unsafe('"')
-          .append_c_string_unsafe(str)
-          .append_char_unsafe('"');
-    } else {
-      dest.reserve_at_least(4 * str.length() + 2)
-          .append_char_unsafe('"')
-          .append_utf_string_unsafe(str)
-          .append_char_unsafe('"');
-    }
-    return true;
-  } else if constexpr (HaltsOnInvalid) {
-    return false;
-  } else {
-    dest.append_c_string("null");
-    return true;
-  }
+  auto token = enum_json_token_table_v<CharT, T>.get(enum_unique_index(value));
+  return append_enum_json_token<HaltsOnInvalid>(dest, token);
 }
 
 template <bool ToString, bool HaltsOnInvalid, class CharT, class Allocator, class T>
@@ -192,6 +307,367 @@ constexpr bool serializer_dispatch_arithmetic(basic_string_builder<CharT, Alloca
   }
 }
 
+// Member keys of T: `{"name":` for the first member and `,"name":` for the rest.
+template <class CharT, class T>
+constexpr auto struct_json_key_table_v = make_json_token_table<CharT>(
+    std::size(all_flattened_nonstatic_data_members_v<T>),
+    [](basic_string_builder<CharT>& pool, size_t i) {
+      auto name = std::meta::identifier_of(all_flattened_nonstatic_data_members_v<T>[i].member);
+      pool.append_char(i == 0 ? '{' : ',').append_char('"');
+      pool.append_utf_string(name).append_c_string("\":");
+    });
+
+// Member keys of T with indentation: `"name": `. Line breaks and indentation are runtime.
+template <class CharT, class T>
+constexpr auto struct_json_indented_key_table_v = make_json_token_table<CharT>(
+    std::size(all_flattened_nonstatic_data_members_v<T>),
+    [](basic_string_builder<CharT>& pool, size_t i) {
+      auto name = std::meta::identifier_of(all_flattened_nonstatic_data_members_v<T>[i].member);
+      pool.append_char('"').append_utf_string(name).append_c_string("\": ");
+    });
+
+// Bounded values longer than this are not written with a single reservation, which keeps
+// reservations small compared with the buffer of streamed serialization.
+constexpr auto json_bounded_length_limit = 4096zU;
+
+template <serialize_options Options, class CharT, class T>
+consteval size_t json_max_length();
+
+template <class T>
+constexpr auto is_json_leaf_type_v =
+    std::is_same_v<T, std::monostate> || std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+// Upper bound of the JSON length (in CharT units, without indentation) of any value of T,
+// or 0 if unbounded (e.g. strings and dynamic ranges) or longer than json_bounded_length_limit.
+template <serialize_options Options, class CharT, class T>
+constexpr auto json_max_length_v = json_max_length<Options, CharT, std::remove_cv_t<T>>();
+
+template <serialize_options Options, class CharT, class... Ts>
+consteval size_t json_max_length_of_sequence() {
+  auto lengths = std::array<size_t, sizeof...(Ts)>{json_max_length_v<Options, CharT, Ts>...};
+  auto res = std::max(2zU, 1 + sizeof...(Ts));  // Brackets and commas
+  for (auto n : lengths) {
+    if (n == 0) {
+      return 0;
+    }
+    res += n;
+  }
+  return res;
+}
+
+template <serialize_options Options, class CharT, class T>
+consteval size_t json_max_length_of_struct() {
+  constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  constexpr auto N = std::size(members);
+  if constexpr (N == 0) {
+    return 2;  // "{}"
+  } else {
+    auto res = 1zU;  // '}'
+    template for (constexpr auto I : std::views::iota(0zU, N)) {
+      constexpr auto n = json_max_length_v<Options, CharT, typename [:members[I].type():]>;
+      if (res == 0 || n == 0) {
+        res = 0;
+      } else {
+        res += struct_json_key_table_v<CharT, T>.get(I).length() + n;
+      }
+    }
+    return res;
+  }
+}
+
+template <serialize_options Options, class CharT, class T>
+consteval size_t json_max_length() {
+  auto res = 0zU;
+  if constexpr (std::is_same_v<T, std::monostate>) {
+    res = 4;  // null
+  } else if constexpr (std::is_same_v<T, bool>) {
+    res = 5;  // false
+  } else if constexpr (char_type<T> && Options.char_to_string) {
+    res = 8;  // '"' + 6 (e.g. "\u0000") + '"'
+  } else if constexpr (std::is_integral_v<T>) {
+    res = (sizeof(T) <= sizeof(int64_t)) ? std::numeric_limits<T>::digits10 + 2 : 0;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // Shortest round-trip representations take at most 24 characters.
+    res = (sizeof(T) <= sizeof(double)) ? 32 : 0;
+  } else if constexpr (std::is_enum_v<T>) {
+    if constexpr (!Options.enum_to_string) {
+      res = std::numeric_limits<std::underlying_type_t<T>>::digits10 + 2;
+    } else if constexpr (!enum_flag_type<T>) {
+      res = std::max(4zU, enum_json_token_table_v<CharT, T>.max_length());  // 4: null
+    } else if constexpr (enum_flags_has_name_table_v<T>) {
+      res = std::max(4zU, enum_flags_json_token_table_v<CharT, T>.max_length());
+    }
+  } else if constexpr (string_like<T>) {
+    res = 0;
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    auto n = json_max_length_v<Options, CharT, typename T::value_type>;
+    res = (n == 0) ? 0 : std::max(4zU, n);
+  } else if constexpr (template_instance_of<T, std::variant>) {
+    res = []<size_t... Is>(std::index_sequence<Is...>) {
+      auto lengths =
+          std::array{4zU, json_max_length_v<Options, CharT, std::variant_alternative_t<Is, T>>...};
+      return std::ranges::contains(lengths, 0zU) ? 0zU : std::ranges::max(lengths);
+    }(std::make_index_sequence<std::variant_size_v<T>>());
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    auto n = std::extent_v<T>;
+    auto elem = json_max_length_v<Options, CharT, std::remove_extent_t<T>>;
+    res = (elem == 0) ? 0 : std::max(2zU, 1 + n * (elem + 1));
+  } else if constexpr (template_instance_of<T, std::map>) {
+    res = 0;
+  } else if constexpr (std::ranges::range<T>) {
+    if constexpr (tuple_like<T>) {
+      auto n = std::tuple_size_v<T>;  // e.g. std::array
+      auto elem = json_max_length_v<Options, CharT, std::ranges::range_value_t<T>>;
+      res = (elem == 0) ? 0 : std::max(2zU, 1 + n * (elem + 1));
+    }
+  } else if constexpr (tuple_like<T>) {
+    res = [&]<size_t... Is>(std::index_sequence<Is...>) {
+      return json_max_length_of_sequence<Options, CharT, std::tuple_element_t<Is, T>...>();
+    }(std::make_index_sequence<std::tuple_size_v<T>>());
+  } else if constexpr (flattenable_class<T>) {
+    res = json_max_length_of_struct<Options, CharT, T>();
+  }
+  return (res <= json_bounded_length_limit) ? res : 0;
+}
+
+// Writes value whose json_max_length_v is nonzero, without any reservation.
+template <serialize_options Options, class CharT, class Allocator, class T>
+constexpr bool append_bounded_json_unsafe(basic_string_builder<CharT, Allocator>& dest,
+                                          const T& value) {
+  if constexpr (std::is_same_v<T, std::monostate>) {
+    dest.append_c_string_unsafe("null");
+  } else if constexpr (std::is_same_v<T, bool>) {
+    dest.append_bool_unsafe(value);
+  } else if constexpr (char_type<T> && Options.char_to_string) {
+    dest.append_char_unsafe('"')
+        .append_utf_code_point_json_escaped_unsafe(static_cast<char32_t>(value))
+        .append_char_unsafe('"');
+  } else if constexpr (std::is_integral_v<T>) {
+    dest.append_integer_unsafe(value);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (std::isfinite(value)) [[likely]] {
+      dest.append_floating_point_unsafe(value);
+    } else if constexpr (Options.halts_on_non_finite_floating_point) {
+      return false;
+    } else if (std::isnan(value)) {
+      dest.append_c_string_unsafe("\"NaN\"");
+    } else {
+      dest.append_c_string_unsafe(value > 0 ? "\"Infinity\"" : "\"-Infinity\"");
+    }
+  } else if constexpr (std::is_enum_v<T>) {
+    if constexpr (!Options.enum_to_string) {
+      if constexpr (Options.halts_on_invalid_enum) {
+        if (!enum_contains<T>(value)) return false;
+      }
+      dest.append_integer_unsafe(std::to_underlying(value));
+    } else {
+      auto token = std::basic_string_view<CharT>{};
+      if constexpr (enum_flag_type<T>) {
+        token = enum_flags_json_token_table_v<CharT, T>.get(unsigned_promoted(value));
+      } else {
+        token = enum_json_token_table_v<CharT, T>.get(enum_unique_index(value));
+      }
+      if (!token.empty()) [[likely]] {
+        dest.append_string_unsafe(token);
+      } else if constexpr (Options.halts_on_invalid_enum) {
+        return false;
+      } else {
+        dest.append_c_string_unsafe("null");
+      }
+    }
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    if (!value.has_value()) {
+      dest.append_c_string_unsafe("null");
+    } else {
+      return append_bounded_json_unsafe<Options>(dest, *value);
+    }
+  } else if constexpr (template_instance_of<T, std::variant>) {
+    if (value.valueless_by_exception()) [[unlikely]] {
+      dest.append_c_string_unsafe("null");
+    } else {
+      return std::visit(
+          [&dest](const auto& v) { return append_bounded_json_unsafe<Options>(dest, v); }, value);
+    }
+  } else if constexpr (std::ranges::range<T>) {
+    dest.append_char_unsafe('[');
+    auto is_first = true;
+    for (const auto& elem : value) {
+      is_first ? (void)(is_first = false) : (void)(dest.append_char_unsafe(','));
+      if (!append_bounded_json_unsafe<Options>(dest, elem)) [[unlikely]] {
+        return false;
+      }
+    }
+    dest.append_char_unsafe(']');
+  } else if constexpr (tuple_like<T>) {
+    dest.append_char_unsafe('[');
+    template for (constexpr auto I : std::views::iota(0zU, std::tuple_size_v<T>)) {
+      if constexpr (I > 0) {
+        dest.append_char_unsafe(',');
+      }
+      if (!append_bounded_json_unsafe<Options>(dest, get_ith_element<I>(value))) [[unlikely]] {
+        return false;
+      }
+    }
+    dest.append_char_unsafe(']');
+  } else {
+    constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+    constexpr const auto& keys = struct_json_key_table_v<CharT, T>;
+    constexpr auto N = std::size(members);
+    if constexpr (N == 0) {
+      dest.append_char_unsafe('{');
+    }
+    template for (constexpr auto I : std::views::iota(0zU, N)) {
+      constexpr auto key = keys.get(I);
+      dest.template append_fixed_string_unsafe<key.length()>(key.data());
+      if (!append_bounded_json_unsafe<Options>(dest, value.[:members[I].member:])) [[unlikely]] {
+        return false;
+      }
+    }
+    dest.append_char_unsafe('}');
+  }
+  return true;
+}
+
+// Contiguous ranges of leaf values (e.g. std::vector<int32_t> and std::vector<double>) are
+// written block by block: one reservation per block and no capacity check per element.
+template <serialize_options Options, class CharT, class T>
+consteval bool is_json_leaf_contiguous_range() {
+  if constexpr (std::ranges::contiguous_range<const T> && std::ranges::sized_range<const T>) {
+    using V = std::ranges::range_value_t<T>;
+    return is_json_leaf_type_v<V> && json_max_length_v<Options, CharT, V> != 0;
+  } else {
+    return false;
+  }
+}
+
+template <serialize_options Options, class CharT, class Allocator, class V>
+constexpr bool append_leaf_range(basic_string_builder<CharT, Allocator>& dest,
+                                 std::span<const V> values) {
+  constexpr auto max_length = json_max_length_v<Options, CharT, V> + 1;  // +1: ','
+  constexpr auto block_size = std::max(1zU, json_bounded_length_limit / max_length);
+  dest.append_char('[');
+  for (auto i = 0zU; i < values.size();) {
+    auto block_end = std::min(values.size(), i + block_size);
+    dest.reserve_at_least((block_end - i) * max_length);
+    for (; i < block_end; i++) {
+      if (i != 0) {
+        dest.append_char_unsafe(',');
+      }
+      if (!append_bounded_json_unsafe<Options>(dest, values[i])) [[unlikely]] {
+        return false;
+      }
+    }
+  }
+  dest.append_char(']');
+  return true;
+}
+
+template <serialize_options Options, class CharT, class Allocator, class V>
+constexpr bool append_leaf_range(basic_string_builder<CharT, Allocator>& dest,
+                                 std::span<const V> values,
+                                 int indent_level,
+                                 int indent_size,
+                                 CharT indent_char) {
+  // +2: ',' and '\n'
+  const auto max_length = json_max_length_v<Options, CharT, V> + 2 + (indent_level + indent_size);
+  const auto block_size = std::max(1zU, json_bounded_length_limit / max_length);
+  dest.append_char('[');
+  indent_level += indent_size;
+  if (max_length > json_bounded_length_limit) [[unlikely]] {
+    // Deep indentation: line breaks and values are reserved separately.
+    for (auto i = 0zU; i < values.size(); i++) {
+      dest.reserve_at_least(indent_level + 2);
+      if (i != 0) {
+        dest.append_char_unsafe(',');
+      }
+      dest.append_char_unsafe('\n').append_char_unsafe(indent_char, indent_level);
+      dest.reserve_at_least(json_max_length_v<Options, CharT, V>);
+      if (!append_bounded_json_unsafe<Options>(dest, values[i])) [[unlikely]] {
+        return false;
+      }
+    }
+  } else {
+    for (auto i = 0zU; i < values.size();) {
+      auto block_end = std::min(values.size(), i + block_size);
+      dest.reserve_at_least((block_end - i) * max_length);
+      for (; i < block_end; i++) {
+        if (i != 0) {
+          dest.append_char_unsafe(',');
+        }
+        dest.append_char_unsafe('\n').append_char_unsafe(indent_char, indent_level);
+        if (!append_bounded_json_unsafe<Options>(dest, values[i])) [[unlikely]] {
+          return false;
+        }
+      }
+    }
+  }
+  indent_level -= indent_size;
+  dest.reserve_at_least(indent_level + 2)
+      .append_char_unsafe('\n')
+      .append_char_unsafe(indent_char, indent_level)
+      .append_char_unsafe(']');
+  return true;
+}
+
+// Characters to reserve before writing a member: size + count * (line break and indentation),
+// where count is the number of members covered. Consecutive bounded members share one
+// reservation made before the first of them (others reserve nothing, with count = 0), which is
+// split once exceeding json_bounded_length_limit so that stream buffers never grow.
+// With indentation, only leaf members (e.g. arithmetic and enum) are treated as bounded.
+struct struct_json_reservation {
+  size_t size;
+  size_t count;
+};
+
+template <serialize_options Options, class CharT, class T, bool Indented>
+constexpr auto struct_json_member_max_length_v = 0zU;
+
+template <serialize_options Options, class CharT, class T>
+constexpr auto struct_json_member_max_length_v<Options, CharT, T, false> =
+    json_max_length_v<Options, CharT, T>;
+
+template <serialize_options Options, class CharT, class T>
+constexpr auto struct_json_member_max_length_v<Options, CharT, T, true> =
+    is_json_leaf_type_v<std::remove_cv_t<T>> ? json_max_length_v<Options, CharT, T> : 0;
+
+template <serialize_options Options, class CharT, class T, bool Indented>
+consteval auto make_struct_json_reservations(const json_token_table<CharT>& keys) {
+  constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  constexpr auto N = std::size(members);
+  auto lengths = std::array<size_t, N>{};
+  template for (constexpr auto I : std::views::iota(0zU, N)) {
+    using M = typename [:members[I].type():];
+    lengths[I] = struct_json_member_max_length_v<Options, CharT, M, Indented>;
+  }
+  auto res = std::array<struct_json_reservation, N>{};
+  for (auto i = 0zU; i < N;) {
+    auto& cur = res[i];
+    cur = {.size = keys.get(i).length(), .count = 1};
+    if (lengths[i++] == 0) {
+      continue;
+    }
+    cur.size += lengths[i - 1];
+    for (; i < N && lengths[i] != 0; i++) {
+      auto size = keys.get(i).length() + lengths[i];
+      if (cur.size + size > json_bounded_length_limit) {
+        break;
+      }
+      cur.size += size;
+      cur.count += 1;
+    }
+  }
+  return res;
+}
+
+template <serialize_options Options, class CharT, class T>
+constexpr auto struct_json_reservations_v =
+    make_struct_json_reservations<Options, CharT, T, false>(struct_json_key_table_v<CharT, T>);
+
+template <serialize_options Options, class CharT, class T>
+constexpr auto struct_json_indented_reservations_v =
+    make_struct_json_reservations<Options, CharT, T, true>(
+        struct_json_indented_key_table_v<CharT, T>);
+
 template <class Parent, class CharT, class Allocator, class T, class... Args>
 constexpr bool serializer_dispatch(basic_string_builder<CharT, Allocator>& dest,
                                    const T& value,
@@ -214,11 +690,7 @@ constexpr bool serializer_dispatch(basic_string_builder<CharT, Allocator>& dest,
     return res;
   } else if constexpr (string_like<T>) {
     // (4) String-like types
-    auto str = make_string_view(value);
-    dest.reserve_at_least(6 * str.length() + 2)
-        .append_char_unsafe('"')
-        .append_utf_string_json_escaped_unsafe(str)
-        .append_char_unsafe('"');
+    append_json_string(dest, make_string_view(value));
     return true;
   } else if constexpr (template_instance_of<T, std::optional>) {
     // (7) std::optional
@@ -247,7 +719,13 @@ constexpr bool serializer_dispatch(basic_string_builder<CharT, Allocator>& dest,
     }
   } else if constexpr (std::ranges::range<T>) {
     // (5.2.2) Other range types (including C-style arrays)
-    return Parent::append_range(dest, value, args...);
+    if constexpr (is_json_leaf_contiguous_range<Options, CharT, T>()) {
+      using V = std::ranges::range_value_t<T>;
+      auto values = std::span<const V>{std::ranges::data(value), std::ranges::size(value)};
+      return append_leaf_range<Options>(dest, values, args...);
+    } else {
+      return Parent::append_range(dest, value, args...);
+    }
   } else if constexpr (tuple_like<T>) {
     // (6) Tuple-like types
     return Parent::append_tuple(dest, value, args...);
@@ -281,34 +759,46 @@ struct indented_serializer : indented_serializer_base<indented_serializer<Option
                                       int indent_size,
                                       CharT indent_char) {
     constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+    constexpr const auto& keys = struct_json_indented_key_table_v<CharT, T>;
+    constexpr const auto& reservations = struct_json_indented_reservations_v<Options, CharT, T>;
     constexpr auto N = std::size(members);
     dest.append_char('{');
     indent_level += indent_size;
+    // Whether the current run of bounded members shares one reservation. Otherwise (with deep
+    // indentation that may exceed stream buffers) line breaks and members are reserved one by one.
+    auto shares_reservation = true;
 
     template for (constexpr auto I : std::views::iota(0zU, N)) {
-      constexpr auto cur_member = members[I];
-      constexpr auto cur_member_name = std::meta::identifier_of(cur_member.member);
-      constexpr auto is_ascii_only = is_ascii_string(cur_member_name);
+      using M = typename [:members[I].type():];
+      constexpr auto key = keys.get(I);
+      constexpr auto reservation = reservations[I];
+      constexpr auto max_length = struct_json_member_max_length_v<Options, CharT, M, true>;
+      if constexpr (reservation.count != 0) {
+        // +2: ',' and '\n'
+        auto size = reservation.size + reservation.count * (indent_level + 2);
+        shares_reservation = (size <= json_stream_min_buffer_size);
+        if (shares_reservation) [[likely]] {
+          dest.reserve_at_least(size);
+        }
+      }
+      if (!shares_reservation) [[unlikely]] {
+        dest.reserve_at_least(indent_level + 2);
+      }
       if constexpr (I > 0) {
-        dest.reserve_at_least(indent_level + (is_ascii_only ? 1 : 4) * cur_member_name.length() + 6)
-            .append_char_unsafe(',')   // +1
-            .append_char_unsafe('\n')  // +1
-            .append_char_unsafe(indent_char, indent_level);
-      } else {
-        dest.reserve_at_least(indent_level + (is_ascii_only ? 1 : 4) * cur_member_name.length() + 5)
-            .append_char_unsafe('\n')
-            .append_char_unsafe(indent_char, indent_level);
+        dest.append_char_unsafe(',');
       }
-      dest.append_char_unsafe('"');  // +1
-      if constexpr (is_ascii_only) {
-        dest.append_c_string_unsafe(cur_member_name);
-      } else {
-        dest.append_utf_string_unsafe(cur_member_name);
+      dest.append_char_unsafe('\n').append_char_unsafe(indent_char, indent_level);
+      if (!shares_reservation) [[unlikely]] {
+        dest.reserve_at_least(key.length() + max_length);
       }
-      dest.append_c_string_unsafe("\": ");  // +3: '"', ':' and ' '
-
-      const auto& elem = value.[:cur_member.member:];
-      if (!operator()(dest, elem, indent_level, indent_size, indent_char)) [[unlikely]] {
+      dest.template append_fixed_string_unsafe<key.length()>(key.data());
+
+      const auto& elem = value.[:members[I].member:];
+      if constexpr (max_length != 0) {
+        if (!append_bounded_json_unsafe<Options>(dest, elem)) [[unlikely]] {
+          return false;
+        }
+      } else if (!operator()(dest, elem, indent_level, indent_size, indent_char)) [[unlikely]] {
         return false;
       }
     }
@@ -329,36 +819,41 @@ struct unindented_serializer : unindented_serializer_base<unindented_serializer<
 
   template <class CharT, class Allocator, class T>
   static constexpr bool operator()(basic_string_builder<CharT, Allocator>& dest, const T& value) {
-    return serializer_dispatch<self_type>(dest, value);
+    constexpr auto max_length = json_max_length_v<Options, CharT, T>;
+    if constexpr (max_length != 0) {
+      // One reservation for the whole value (or each element of ranges via append_range)
+      dest.reserve_at_least(max_length);
+      return append_bounded_json_unsafe<Options>(dest, value);
+    } else {
+      return serializer_dispatch<self_type>(dest, value);
+    }
   }
 
   template <class CharT, class Allocator, class T>
   static constexpr bool append_struct(basic_string_builder<CharT, Allocator>& dest,
                                       const T& value) {
     constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+    constexpr const auto& keys = struct_json_key_table_v<CharT, T>;
+    constexpr const auto& reservations = struct_json_reservations_v<Options, CharT, T>;
     constexpr auto N = std::size(members);
-    dest.append_char('{');
+    if constexpr (N == 0) {
+      dest.append_char('{');
+    }
 
     template for (constexpr auto I : std::views::iota(0zU, N)) {
-      constexpr auto cur_member = members[I];
-      constexpr auto cur_member_name = std::meta::identifier_of(cur_member.member);
-      constexpr auto is_ascii_only = is_ascii_string(cur_member_name);
-      if constexpr (I > 0) {
-        dest.reserve_at_least((is_ascii_only ? 1 : 4) * cur_member_name.length() + 4);
-        dest.append_char_unsafe(',');  // +1
-      } else {
-        dest.reserve_at_least((is_ascii_only ? 1 : 4) * cur_member_name.length() + 3);
+      constexpr auto key = keys.get(I);
+      if constexpr (reservations[I].count != 0) {
+        dest.reserve_at_least(reservations[I].size);
       }
-      dest.append_char_unsafe('"');  // +1
-      if constexpr (is_ascii_only) {
-        dest.append_c_string_unsafe(cur_member_name);
-      } else {
-        dest.append_utf_string_unsafe(cur_member_name);
-      }
-      dest.append_c_string_unsafe("\":");  // +2: '"' and ':'
-
-      const auto& elem = value.[:cur_member.member:];
-      if (!operator()(dest, elem)) [[unlikely]] {
+      dest.template append_fixed_string_unsafe<key.length()>(key.data());
+
+      using M = typename [:members[I].type():];
+      const auto& elem = value.[:members[I].member:];
+      if constexpr (json_max_length_v<Options, CharT, M> != 0) {
+        if (!append_bounded_json_unsafe<Options>(dest, elem)) [[unlikely]] {
+          return false;
+        }
+      } else if (!operator()(dest, elem)) [[unlikely]] {
         return false;
       }
     }
@@ -366,6 +861,73 @@ struct unindented_serializer : unindented_serializer_base<unindented_serializer<
     return true;
   }
 };
+
+template <class CharT, class Sink>
+struct stream_flusher {
+  Sink& sink;
+  bool ok = true;
+
+  static void flush(void* context, const CharT* data, size_t length) {
+    auto* self = static_cast<stream_flusher*>(context);
+    if (self->ok) {
+      self->ok = self->write(data, length);
+    }
+  }
+
+  bool write(const CharT* data, size_t length) {
+    using SinkT = std::remove_cvref_t<Sink>;
+#if __has_include(<unistd.h>)
+    if constexpr (std::is_same_v<SinkT, fd_sink>) {
+      const auto* bytes = reinterpret_cast<const char*>(data);
+      auto remaining = length * sizeof(CharT);
+      while (remaining > 0) {
+        auto n = ::write(sink.fd(), bytes, remaining);
+        if (n < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        bytes += n;
+        remaining -= static_cast<size_t>(n);
+      }
+      return true;
+    } else
+#endif
+    if constexpr (std::is_same_v<std::decay_t<Sink>, std::FILE*>) {
+      return std::fwrite(data, sizeof(CharT), length, sink) == length;
+    } else if constexpr (std::is_base_of_v<std::basic_ostream<CharT>, SinkT>) {
+      sink.write(data, static_cast<std::streamsize>(length));
+      return !sink.fail();
+    } else {
+      auto str = std::basic_string_view<CharT>{data, length};
+      using R = std::invoke_result_t<Sink&, std::basic_string_view<CharT>>;
+      if constexpr (std::is_convertible_v<R, bool>) {
+        return static_cast<bool>(std::invoke(sink, str));
+      } else {
+        std::invoke(sink, str);
+        return true;
+      }
+    }
+  }
+};
+
+template <class Serializer, class CharT, class Sink, class T, class... Args>
+bool serialize_to_sink(Sink& sink,
+                       json_stream_options stream_options,
+                       const T& value,
+                       const Args&... args) {
+  using flusher_type = stream_flusher<CharT, Sink>;
+  auto flusher = flusher_type{.sink = sink};
+  auto buffer_size = std::max(stream_options.buffer_size, json_stream_min_buffer_size);
+  auto builder = basic_string_builder<CharT>{buffer_size};
+  builder.set_flush_handler(&flusher_type::flush, &flusher);
+  if (!Serializer::operator()(builder, value, args...)) [[unlikely]] {
+    return false;
+  }
+  builder.flush();
+  return flusher.ok;
+}
 }  // namespace impl::json
 
 template <serialize_options Options = {}, class CharT, class Allocator, serializable T>
@@ -422,6 +984,30 @@ constexpr auto serialize_to_json(const T& value,
     }
   }
 }
+
+// Streams JSON to the sink through a bounded buffer. Returns false if serialization halts
+// (see serialize_options) or the sink fails, in which case the output is incomplete.
+template <serialize_options Options = {},
+          class CharT = char,
+          serializable T,
+          json_output_sink<CharT> Sink>
+bool serialize_to_json(Sink&& sink, const T& value, json_stream_options stream_options = {}) {
+  return impl::json::serialize_to_sink<impl::json::unindented_serializer<Options>, CharT>(
+      sink, stream_options, value);
+}
+
+template <serialize_options Options = {},
+          class CharT = char,
+          serializable T,
+          json_output_sink<CharT> Sink>
+bool serialize_to_json(Sink&& sink,
+                       const T& value,
+                       int indent_size,
+                       CharT indent_char = static_cast<CharT>(' '),
+                       json_stream_options stream_options = {}) {
+  return impl::json::serialize_to_sink<impl::json::indented_serializer<Options>, CharT>(
+      sink, stream_options, value, 0, indent_size, indent_char);
+}
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_HPP
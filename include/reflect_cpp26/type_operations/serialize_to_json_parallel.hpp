@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_PARALLEL_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <optional>
+#include <ranges>
+#include <reflect_cpp26/type_operations/serialize_to_json.hpp>
+#include <thread>
+#include <vector>
+
+namespace reflect_cpp26 {
+struct json_parallel_options {
+  // Ranges with fewer elements are serialized sequentially.
+  size_t min_size = 4096;
+  // Number of elements serialized by each task.
+  size_t chunk_size = 1024;
+};
+
+// Task submitted to executors: serializes the k-th chunk when invoked with k. Trivially copyable
+// and safe to invoke concurrently with different k.
+class json_parallel_task {
+public:
+  template <class Fn>
+  explicit json_parallel_task(const Fn& fn)
+      : fn_(&json_parallel_task::invoke<Fn>), context_(&fn) {}
+
+  void operator()(size_t k) const {
+    fn_(context_, k);
+  }
+
+private:
+  template <class Fn>
+  static void invoke(const void* context, size_t k) {
+    (*static_cast<const Fn*>(context))(k);
+  }
+
+  void (*fn_)(const void*, size_t);
+  const void* context_;
+};
+
+// Executors run tasks 0, 1, ..., n - 1 (in any order, possibly concurrently) and return after
+// all of them finish, e.g. a thread pool adaptor, or with std::execution policies:
+//   [](size_t n, const json_parallel_task& task) {
+//     auto ids = std::views::iota(0zU, n);
+//     std::for_each(std::execution::par, ids.begin(), ids.end(), task);
+//   }
+template <class Executor>
+concept json_executor = std::invocable<Executor&, size_t, const json_parallel_task&>;
+
+// Runs tasks on at most max_threads threads (including the caller thread), where 0 indicates
+// std::thread::hardware_concurrency().
+struct json_thread_executor {
+  size_t max_threads = 0;
+
+  template <class Task>
+  void operator()(size_t n_tasks, const Task& task) const {
+    auto n_threads = (max_threads != 0) ? max_threads : std::thread::hardware_concurrency();
+    n_threads = std::min<size_t>(std::max<size_t>(n_threads, 1), n_tasks);
+    auto next = std::atomic<size_t>{0};
+    auto worker = [&]() {
+      for (auto i = next.fetch_add(1); i < n_tasks; i = next.fetch_add(1)) {
+        task(i);
+      }
+    };
+    auto threads = std::vector<std::jthread>{};
+    threads.reserve(n_threads);
+    for (auto i = 1zU; i < n_threads; i++) {
+      threads.emplace_back(worker);
+    }
+    worker();
+  }
+};
+
+template <class T>
+concept json_parallel_range = serializable<T> && std::ranges::random_access_range<const T>
+                              && std::ranges::sized_range<const T> && !string_like<T>;
+
+namespace impl::json {
+// Each chunk is serialized exactly as the sequential serializer writes the same elements
+// (including the separators before them), so that concatenation in order gives identical output.
+template <class Serializer, bool Indented, class CharT, class Executor, class T>
+auto serialize_range_parallel(Executor& executor,
+                              const T& range,
+                              json_parallel_options options,
+                              int indent_size,
+                              CharT indent_char) -> std::optional<std::basic_string<CharT>> {
+  auto n = static_cast<size_t>(std::ranges::size(range));
+  auto chunk_size = std::max(options.chunk_size, 1zU);
+  auto n_chunks = (n + chunk_size - 1) / chunk_size;
+  auto chunks = std::vector<basic_string_builder<CharT>>(n_chunks);
+  auto succeeded = std::vector<char>(n_chunks, true);  // Not std::vector<bool> to avoid data race
+
+  auto task = [&](size_t k) {
+    auto& dest = chunks[k];
+    auto first = k * chunk_size;
+    auto last = std::min(n, first + chunk_size);
+    auto iter = std::ranges::begin(range) + first;
+    for (auto i = first; i < last; ++i, ++iter) {
+      if (i != 0) {
+        dest.append_char(',');
+      }
+      auto ok = true;
+      if constexpr (Indented) {
+        dest.reserve_at_least(indent_size + 1)
+            .append_char_unsafe('\n')
+            .append_char_unsafe(indent_char, indent_size);
+        ok = Serializer::operator()(dest, *iter, indent_size, indent_size, indent_char);
+      } else {
+        ok = Serializer::operator()(dest, *iter);
+      }
+      if (!ok) [[unlikely]] {
+        succeeded[k] = false;
+        return;
+      }
+    }
+  };
+  executor(n_chunks, json_parallel_task{task});
+
+  if (std::ranges::contains(succeeded, false)) [[unlikely]] {
+    return std::nullopt;
+  }
+  auto total_size = 3zU;  // '[', ']' and '\n' before ']' if indented
+  for (const auto& chunk : chunks) {
+    total_size += chunk.size();
+  }
+  auto res = std::basic_string<CharT>{};
+  res.reserve(total_size);
+  res += static_cast<CharT>('[');
+  for (const auto& chunk : chunks) {
+    res += chunk.strview();
+  }
+  if constexpr (Indented) {
+    res += static_cast<CharT>('\n');
+  }
+  res += static_cast<CharT>(']');
+  return res;
+}
+
+template <serialize_options Options, class CharT>
+auto parallel_result(std::optional<std::basic_string<CharT>> res) {
+  if constexpr (Options.never_halts()) {
+    return std::move(*res);
+  } else {
+    return res;
+  }
+}
+}  // namespace impl::json
+
+/**
+ * Serializes elements of large top-level range concurrently with the given executor and
+ * concatenates the results in order. The output (and return type) is identical with
+ * serialize_to_json<CharT, Options>(value).
+ */
+template <class CharT = char,
+          serialize_options Options = {},
+          json_parallel_range T,
+          json_executor Executor>
+auto serialize_to_json_parallel(Executor&& executor,
+                                const T& value,
+                                json_parallel_options options = {}) /* -> (see above) */ {
+  if (std::ranges::size(value) < options.min_size) {
+    return serialize_to_json<CharT, Options>(value);
+  }
+  using serializer = impl::json::unindented_serializer<Options>;
+  auto res = impl::json::serialize_range_parallel<serializer, false>(
+      executor, value, options, 0, static_cast<CharT>(' '));
+  return impl::json::parallel_result<Options>(std::move(res));
+}
+
+template <class CharT = char,
+          serialize_options Options = {},
+          json_parallel_range T,
+          json_executor Executor>
+auto serialize_to_json_parallel(Executor&& executor,
+                                const T& value,
+                                int indent_size,
+                                CharT indent_char = static_cast<CharT>(' '),
+                                json_parallel_options options = {}) /* -> (see above) */ {
+  if (std::ranges::size(value) < options.min_size) {
+    return serialize_to_json<CharT, Options>(value, indent_size, indent_char);
+  }
+  using serializer = impl::json::indented_serializer<Options>;
+  auto res = impl::json::serialize_range_parallel<serializer, true>(
+      executor, value, options, indent_size, indent_char);
+  return impl::json::parallel_result<Options>(std::move(res));
+}
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_SERIALIZE_TO_JSON_PARALLEL_HPP
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_VALIDATE_JSON_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_VALIDATE_JSON_HPP
+
+#include <reflect_cpp26/type_operations/deserialize_from_json.hpp>
+#include <string_view>
+#include <type_traits>
+
+namespace reflect_cpp26 {
+/**
+ * Checks whether JSON text (UTF-8) is well-formed and accepted by deserialize_from_json<T>
+ * with the same options. Input is read by the same readers in dry-run mode, where strings and
+ * containers are validated without being stored: object keys are matched against member names,
+ * enum strings against enumerator names, and numbers are range-checked against their targets.
+ */
+template <deserializable T, deserialize_options Options = {}>
+constexpr bool validate_json(std::string_view json) {
+  auto reader = impl::json::json_reader{
+      .cur = json.data(),
+      .end = json.data() + json.size(),
+      .dry_run = true,
+  };
+  auto scratch = std::remove_cv_t<T>{};
+  return impl::json::read_json_value<Options>(reader, scratch) && reader.at_end();
+}
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_TYPE_OPERATIONS_VALIDATE_JSON_HPP
@@ -29,6 +29,7 @@
 #include <reflect_cpp26/type_traits/string_like_types.hpp>
 #include <reflect_cpp26/type_traits/tuple_like_types.hpp>
 #include <reflect_cpp26/utils/meta_utility.hpp>
+#include <span>
 #include <variant>
 
 namespace reflect_cpp26 {
@@ -37,11 +38,24 @@ consteval bool is_serializable_type(std::meta::info T);
 
 template <class T>
 consteval bool is_serializable_class_type();
+
+consteval bool is_deserializable_type(std::meta::info T, bool in_situ);
+
+template <class T, bool InSitu>
+consteval bool is_deserializable_class_type();
 }  // namespace impl
 
 template <class T>
 concept serializable = impl::is_serializable_type(remove_cv(^^T));
 
+template <class T>
+concept deserializable = impl::is_deserializable_type(^^T, false);
+
+// Types deserializable in-situ, which may refer to the (mutable) JSON input buffer or to an
+// arena, in addition to deserializable types: std::string_view and std::span<T>.
+template <class T>
+concept deserializable_in_situ = impl::is_deserializable_type(^^T, true);
+
 namespace impl {
 consteval bool test_serializable_flattened_members(
     std::span<const flattened_data_member_info> members) {
@@ -112,6 +126,129 @@ consteval bool is_serializable_type(std::meta::info T) {
   }
   return false;
 }
+
+// Containers that are cleared and then filled element by element during deserialization.
+template <class T>
+concept json_back_insertable_range = std::ranges::range<T> && requires(T& range) {
+  range.clear();
+  range.emplace_back();
+  range.back();
+};
+
+template <class T>
+concept json_insertable_range =
+    std::ranges::range<T> && requires(T& range, typename T::value_type&& value) {
+      range.clear();
+      range.insert(std::move(value));
+    };
+
+// Associative containers whose elements are key-value pairs, e.g. std::map and
+// std::unordered_map.
+template <class T>
+concept json_mapped_range = json_insertable_range<T> && requires {
+  typename T::key_type;
+  typename T::mapped_type;
+};
+
+template <class T>
+using json_key_t = typename T::key_type;
+
+template <class T>
+using json_mapped_t = typename T::mapped_type;
+
+consteval bool test_deserializable_flattened_members(
+    std::span<const flattened_data_member_info> members, bool in_situ) {
+  auto names = std::vector<std::string_view>{};
+  for (auto M : members) {
+    if (!extract<bool>(in_situ ? ^^deserializable_in_situ : ^^deserializable, type_of(M.member))) {
+      return false;
+    }
+    names.push_back(identifier_of(M.member));
+  }
+  // Checks name duplication
+  std::ranges::sort(names);
+  return std::ranges::adjacent_find(names) == names.end();
+}
+
+// Precondition: T satisfies flattenable_class
+template <class T, bool InSitu>
+consteval bool is_deserializable_class_type() {
+  constexpr const auto& members = all_flattened_nonstatic_data_members_v<T>;
+  return test_deserializable_flattened_members(members, InSitu);
+}
+
+consteval bool is_deserializable_type(std::meta::info T, bool in_situ) {
+  auto deserializable_element = [in_situ](std::meta::info U) {
+    return extract<bool>(in_situ ? ^^deserializable_in_situ : ^^deserializable, U);
+  };
+  // Values are created with default construction and then assigned in place.
+  if (is_const_type(T) || is_volatile_type(T) || !is_default_constructible_type(T)) {
+    return false;
+  }
+  // (1) std::monostate; (2) Arithmetic types; (3) Enum types
+  if (T == ^^std::monostate || is_arithmetic_type(T) || is_enum_type(T)) {
+    return true;
+  }
+  // (4) String-like types: Only std::basic_string, which owns and resizes its content,
+  // or std::string_view into the input buffer (in-situ only).
+  if (extract<bool>(^^string_like, T)) {
+    if (in_situ && dealias(T) == dealias(^^std::string_view)) {
+      return true;
+    }
+    return has_template_arguments(T) && template_of(T) == ^^std::basic_string;
+  }
+  // (4.1) std::span<U> allocated from an arena (in-situ only), which never destroys elements.
+  if (in_situ && has_template_arguments(T) && template_of(T) == ^^std::span) {
+    auto args = template_arguments_of(T);
+    if (args[1] != std::meta::reflect_constant(std::dynamic_extent)) {
+      return false;
+    }
+    auto U = args[0];
+    return is_trivially_destructible_type(U) && deserializable_element(remove_const(U));
+  }
+  // (5) Bounded arrays and containers
+  if (is_bounded_array_type(T)) {
+    return deserializable_element(remove_extent(T));
+  }
+  if (extract<bool>(^^json_mapped_range, T)) {
+    auto params_il = {T};
+    auto K = substitute(^^json_key_t, params_il);
+    auto V = substitute(^^json_mapped_t, params_il);
+    return deserializable_element(K) && deserializable_element(V);
+  }
+  if (extract<bool>(^^json_back_insertable_range, T)
+      || extract<bool>(^^json_insertable_range, T)) {
+    auto params_il = {T};
+    auto U = substitute(^^std::ranges::range_value_t, params_il);
+    return deserializable_element(U);
+  }
+  // (6) Tuple-like types (including std::array)
+  if (extract<bool>(^^tuple_like, T)) {
+    auto n = tuple_size(T);
+    for (auto i = 0zU; i < n; i++) {
+      if (!deserializable_element(tuple_element(i, T))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  // (7) std::optional
+  if (has_template_arguments(T) && template_of(T) == ^^std::optional) {
+    auto U = template_arguments_of(T)[0];
+    return deserializable_element(U);
+  }
+  // (8) std::variant
+  if (has_template_arguments(T) && template_of(T) == ^^std::variant) {
+    auto Us = template_arguments_of(T);
+    return std::ranges::all_of(Us, deserializable_element);
+  }
+  // (9) Flattenable class types
+  if (extract<bool>(^^flattenable_class, T)) {
+    auto in_situ_param = std::meta::reflect_constant(in_situ);
+    return extract<bool (*)()>(^^is_deserializable_class_type, T, in_situ_param)();
+  }
+  return false;
+}
 }  // namespace impl
 }  // namespace reflect_cpp26
 
@@ -38,6 +38,7 @@
 #include <reflect_cpp26/utils/meta_string_view.hpp>
 #include <reflect_cpp26/utils/meta_tuple.hpp>
 #include <reflect_cpp26/utils/meta_utility.hpp>
+#include <reflect_cpp26/utils/number_parsing.hpp>
 #include <reflect_cpp26/utils/ranges.hpp>
 #include <reflect_cpp26/utils/string_builder.hpp>
 #include <reflect_cpp26/utils/string_encoding.hpp>
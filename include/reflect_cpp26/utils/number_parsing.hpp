@@ -0,0 +1,488 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#ifndef REFLECT_CPP26_UTILS_NUMBER_PARSING_HPP
+#define REFLECT_CPP26_UTILS_NUMBER_PARSING_HPP
+
+#include <array>
+#include <bit>
+#include <cfloat>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <reflect_cpp26/type_traits/arithmetic_types.hpp>
+#include <type_traits>
+
+namespace reflect_cpp26 {
+namespace impl::number_parsing {
+constexpr bool is_digit(char c) {
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+// Loads 8 characters as a little-endian 64-bit word.
+constexpr auto load_8_chars(const char* p) -> uint64_t {
+  if !consteval {
+    if constexpr (std::endian::native == std::endian::little) {
+      auto res = uint64_t{};
+      std::memcpy(&res, p, 8);
+      return res;
+    }
+  }
+  auto res = uint64_t{};
+  for (auto i = 0; i < 8; i++) {
+    res |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (i * 8);
+  }
+  return res;
+}
+
+// Whether all the 8 bytes are within '0' (0x30) to '9' (0x39).
+constexpr bool is_8_digits(uint64_t v) {
+  auto a = v + 0x0606'0606'0606'0606;
+  auto b = (v & 0xF0F0'F0F0'F0F0'F0F0) | ((a & 0xF0F0'F0F0'F0F0'F0F0) >> 4);
+  return b == 0x3333'3333'3333'3333;
+}
+
+// Converts 8 digits to their value with 3 multiplications (SWAR).
+constexpr auto parse_8_digits(uint64_t v) -> uint32_t {
+  v = (v & 0x0F0F'0F0F'0F0F'0F0F) * 2561 >> 8;  // 10 << 8 | 1: pairs of digits
+  v = (v & 0x00FF'00FF'00FF'00FF) * 6553601 >> 16;  // 100 << 16 | 1: groups of 4
+  return static_cast<uint32_t>((v & 0x0000'FFFF'0000'FFFF) * 42949672960001 >> 32);
+}
+
+// Accumulates digits in [p, end) into w while w has fewer than 19 digits (so that no
+// overflow occurs). Returns the number of digits consumed; w_digits is updated.
+constexpr auto accumulate_digits(const char*& p, const char* end, uint64_t& w, int& w_digits)
+    -> size_t {
+  const auto* first = p;
+  while (end - p >= 8 && w_digits <= 19 - 8) {
+    auto v = load_8_chars(p);
+    if (!is_8_digits(v)) break;
+    w = w * 100'000'000 + parse_8_digits(v);
+    w_digits += 8;
+    p += 8;
+  }
+  for (; p < end && w_digits < 19 && is_digit(*p); ++p) {
+    w = w * 10 + static_cast<uint64_t>(*p - '0');
+    w_digits += 1;
+  }
+  return static_cast<size_t>(p - first);
+}
+
+struct uint128_words {
+  uint64_t high;
+  uint64_t low;
+};
+
+constexpr auto full_multiplication(uint64_t a, uint64_t b) -> uint128_words {
+#ifdef __SIZEOF_INT128__
+  auto r = static_cast<unsigned __int128>(a) * b;
+  return {static_cast<uint64_t>(r >> 64), static_cast<uint64_t>(r)};
+#else
+  auto a_lo = a & 0xFFFF'FFFF, a_hi = a >> 32;
+  auto b_lo = b & 0xFFFF'FFFF, b_hi = b >> 32;
+  auto lo_lo = a_lo * b_lo;
+  auto hi_lo = a_hi * b_lo;
+  auto lo_hi = a_lo * b_hi;
+  auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+  auto high = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+  return {high, (cross << 32) | (lo_lo & 0xFFFF'FFFF)};
+#endif
+}
+
+constexpr int smallest_power_of_five = -342;
+constexpr int largest_power_of_five = 308;
+constexpr size_t power_of_five_count = largest_power_of_five - smallest_power_of_five + 1;
+
+// 5^q for q in [-342, 308], normalized so that the most significant bit is set and
+// truncated to 128 bits (rounded up for q < 0 unless 5^-q fits in 64 bits), stored as
+// {high, low} pairs. Computed at compile-time with 256-bit working precision, which
+// reproduces the exact table of the Eisel-Lemire algorithm.
+constexpr auto power_of_five_table = []() {
+  using limbs = std::array<uint64_t, 4>;  // Little-endian limbs
+  auto res = std::array<uint64_t, 2 * power_of_five_count>{};
+  auto store = [&res](int q, const limbs& v) {
+    auto i = static_cast<size_t>(q - smallest_power_of_five) * 2;
+    res[i] = v[3];
+    res[i + 1] = v[2];
+  };
+  auto shift_left_1 = [](limbs& v) {
+    for (auto i = 3; i > 0; i--) {
+      v[i] = (v[i] << 1) | (v[i - 1] >> 63);
+    }
+    v[0] <<= 1;
+  };
+  // Negative exponents: divides by 5 repeatedly and renormalizes.
+  auto v = limbs{0, 0, 0, uint64_t{1} << 63};
+  store(0, v);
+  for (auto q = -1; q >= smallest_power_of_five; q--) {
+    auto rem = uint64_t{0};
+    for (auto i = 3; i >= 0; i--) {
+      // (rem * 2^64 + v[i]) / 5 where rem < 5, computed in 32-bit halves.
+      auto lo = v[i];
+      auto cur = (rem << 32) | (lo >> 32);
+      auto q_hi = cur / 5;
+      cur = ((cur % 5) << 32) | (lo & 0xFFFF'FFFF);
+      v[i] = (q_hi << 32) | (cur / 5);
+      rem = cur % 5;
+    }
+    while ((v[3] >> 63) == 0) {
+      shift_left_1(v);
+    }
+    auto entry = v;
+    if (q >= -27) {
+      // 5^27 < 2^64: rounds up since the truncated value is never exact.
+      if (++entry[2] == 0) ++entry[3];
+    }
+    store(q, entry);
+  }
+  // Positive exponents: multiplies by 5 and drops the overflowing bits.
+  v = limbs{0, 0, 0, uint64_t{1} << 63};
+  for (auto q = 1; q <= largest_power_of_five; q++) {
+    auto carry = uint64_t{0};
+    for (auto i = 0; i < 4; i++) {
+      auto [hi, lo] = full_multiplication(v[i], 5);
+      lo += carry;
+      carry = hi + (lo < carry);
+      v[i] = lo;
+    }
+    while (carry != 0) {
+      for (auto i = 0; i < 3; i++) {
+        v[i] = (v[i] >> 1) | (v[i + 1] << 63);
+      }
+      v[3] = (v[3] >> 1) | (carry << 63);
+      carry >>= 1;
+    }
+    store(q, v);
+  }
+  return res;
+}();
+
+template <class FloatT>
+struct binary_format;
+
+template <>
+struct binary_format<double> {
+  using bits_type = uint64_t;
+  static constexpr int mantissa_explicit_bits = 52;
+  static constexpr int minimum_exponent = -1023;
+  static constexpr int infinite_power = 0x7FF;
+  static constexpr int min_exponent_round_to_even = -4;
+  static constexpr int max_exponent_round_to_even = 23;
+  static constexpr int max_exponent_fast_path = 22;
+  static constexpr uint64_t max_mantissa_fast_path = uint64_t{2} << 52;
+  static constexpr int smallest_power_of_ten = -342;
+  static constexpr int largest_power_of_ten = 308;
+  static constexpr double exact_powers_of_ten[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+  };
+};
+
+template <>
+struct binary_format<float> {
+  using bits_type = uint32_t;
+  static constexpr int mantissa_explicit_bits = 23;
+  static constexpr int minimum_exponent = -127;
+  static constexpr int infinite_power = 0xFF;
+  static constexpr int min_exponent_round_to_even = -17;
+  static constexpr int max_exponent_round_to_even = 10;
+  static constexpr int max_exponent_fast_path = 10;
+  static constexpr uint64_t max_mantissa_fast_path = uint64_t{2} << 23;
+  static constexpr int smallest_power_of_ten = -65;
+  static constexpr int largest_power_of_ten = 38;
+  static constexpr float exact_powers_of_ten[] = {
+      1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+  };
+};
+
+// Biased binary exponent and explicit mantissa bits.
+struct adjusted_mantissa {
+  uint64_t mantissa;
+  int32_t power2;
+
+  constexpr bool operator==(const adjusted_mantissa&) const = default;
+};
+
+// Eisel-Lemire algorithm: computes the nearest binary floating-point value of w * 10^q
+// with a 128-bit approximation of 5^q. Exact for w with at most 19 digits.
+template <class FloatT>
+constexpr auto compute_float(int64_t q, uint64_t w) -> adjusted_mantissa {
+  using format = binary_format<FloatT>;
+  constexpr auto mantissa_bits = format::mantissa_explicit_bits;
+
+  if (w == 0 || q < format::smallest_power_of_ten) {
+    return {0, 0};
+  }
+  if (q > format::largest_power_of_ten) {
+    return {0, format::infinite_power};
+  }
+  auto lz = std::countl_zero(w);
+  w <<= lz;
+  // Only mantissa_bits + 3 leading bits are needed. The second half of 5^q is involved
+  // only if the first product may be inexact within these bits.
+  auto index = static_cast<size_t>(q - smallest_power_of_five) * 2;
+  auto product = full_multiplication(w, power_of_five_table[index]);
+  constexpr auto precision_mask = ~uint64_t{0} >> (mantissa_bits + 3);
+  if ((product.high & precision_mask) == precision_mask) {
+    auto second = full_multiplication(w, power_of_five_table[index + 1]);
+    product.low += second.high;
+    if (second.high > product.low) {
+      product.high += 1;
+    }
+  }
+  auto upper_bit = static_cast<int>(product.high >> 63);
+  auto shift = upper_bit + 64 - mantissa_bits - 3;
+  auto res = adjusted_mantissa{};
+  res.mantissa = product.high >> shift;
+  // ((152170 + 65536) * q) >> 16 == floor(q * log2(10)) for q in [-1233, 1233]
+  auto power = static_cast<int32_t>(((152170 + 65536) * q) >> 16) + 63;
+  res.power2 = power + upper_bit - lz - format::minimum_exponent;
+
+  if (res.power2 <= 0) {
+    // Subnormal or zero
+    if (-res.power2 + 1 >= 64) {
+      return {0, 0};
+    }
+    res.mantissa >>= -res.power2 + 1;
+    res.mantissa += res.mantissa & 1;
+    res.mantissa >>= 1;
+    res.power2 = res.mantissa < (uint64_t{1} << mantissa_bits) ? 0 : 1;
+    return res;
+  }
+  // Exactly halfway between two representable values: rounds to even.
+  if (product.low <= 1 && q >= format::min_exponent_round_to_even
+      && q <= format::max_exponent_round_to_even && (res.mantissa & 3) == 1) {
+    if ((res.mantissa << shift) == product.high) {
+      res.mantissa &= ~uint64_t{1};
+    }
+  }
+  res.mantissa += res.mantissa & 1;
+  res.mantissa >>= 1;
+  if (res.mantissa >= (uint64_t{2} << mantissa_bits)) {
+    res.mantissa = uint64_t{1} << mantissa_bits;
+    res.power2 += 1;
+  }
+  res.mantissa &= ~(uint64_t{1} << mantissa_bits);
+  if (res.power2 >= format::infinite_power) {
+    return {0, format::infinite_power};
+  }
+  return res;
+}
+
+template <class FloatT>
+constexpr auto to_float(bool negative, adjusted_mantissa am) -> FloatT {
+  using format = binary_format<FloatT>;
+  using bits_type = typename format::bits_type;
+  auto bits = static_cast<bits_type>(am.mantissa)
+            | (static_cast<bits_type>(am.power2) << format::mantissa_explicit_bits);
+  if (negative) {
+    bits |= bits_type{1} << (sizeof(bits_type) * 8 - 1);
+  }
+  return std::bit_cast<FloatT>(bits);
+}
+
+// Clinger's fast path requires arithmetic without excess precision.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0 && FLT_EVAL_METHOD != 1
+constexpr bool clinger_fast_path_enabled = false;
+#else
+constexpr bool clinger_fast_path_enabled = true;
+#endif
+}  // namespace impl::number_parsing
+
+/**
+ * Parses an integer following the JSON number grammar -?(0|[1-9][0-9]*).
+ * Same convention as std::from_chars: returns {first, invalid_argument} if no digits are
+ * found, or {end of digits, result_out_of_range} if the value is not representable by
+ * IntegerT. value is unmodified on failure. A minus sign is rejected for unsigned types.
+ * Parsing stops right after the leading digit '0'.
+ */
+template <non_bool_integral IntegerT>
+  requires(sizeof(IntegerT) <= sizeof(int64_t))
+constexpr auto parse_integer(const char* first, const char* last, IntegerT& value)
+    -> std::from_chars_result {
+  using namespace impl::number_parsing;
+  using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+  const auto* p = first;
+  auto negative = false;
+  if constexpr (std::is_signed_v<IntegerT>) {
+    if (p < last && *p == '-') {
+      negative = true;
+      ++p;
+    }
+  }
+  if (p == last || !is_digit(*p)) {
+    return {first, std::errc::invalid_argument};
+  }
+  auto w = uint64_t{};
+  if (*p == '0') {
+    ++p;
+  } else {
+    auto w_digits = 0;
+    accumulate_digits(p, last, w, w_digits);
+    if (p < last && is_digit(*p)) {
+      // 20 digits or more: at most one more digit fits in uint64_t.
+      auto d = static_cast<uint64_t>(*p++ - '0');
+      auto overflow = w > (UINT64_MAX - d) / 10;
+      w = w * 10 + d;
+      for (; p < last && is_digit(*p); ++p) {
+        overflow = true;
+      }
+      if (overflow) {
+        return {p, std::errc::result_out_of_range};
+      }
+    }
+  }
+  constexpr auto max_value = static_cast<uint64_t>(std::numeric_limits<IntegerT>::max());
+  if (negative) {
+    if (w > max_value + 1) {
+      return {p, std::errc::result_out_of_range};
+    }
+    value = static_cast<IntegerT>(UnsignedT{0} - static_cast<UnsignedT>(w));
+  } else {
+    if (w > max_value) {
+      return {p, std::errc::result_out_of_range};
+    }
+    value = static_cast<IntegerT>(w);
+  }
+  return {p, std::errc{}};
+}
+
+/**
+ * Parses a floating-point number following the JSON number grammar
+ * -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)? with round-to-nearest-even.
+ * Same convention as std::from_chars: returns {first, invalid_argument} if no digits are
+ * found, or {end of number, result_out_of_range} if the value overflows to infinity or
+ * underflows to zero. value is unmodified on failure.
+ *
+ * float and double are parsed with Clinger's fast path and the Eisel-Lemire algorithm.
+ * The rare ambiguous cases (more than 19 significant digits very close to a halfway
+ * point) and long double fall back to std::from_chars, which is unavailable during
+ * constant evaluation where {end of number, not_supported} is returned instead.
+ */
+template <std::floating_point FloatT>
+constexpr auto parse_floating_point(const char* first, const char* last, FloatT& value)
+    -> std::from_chars_result {
+  using namespace impl::number_parsing;
+  const auto* p = first;
+  auto negative = false;
+  if (p < last && *p == '-') {
+    negative = true;
+    ++p;
+  }
+  if (p == last || !is_digit(*p)) {
+    return {first, std::errc::invalid_argument};
+  }
+  // value = w * 10^q (approximately if truncated)
+  auto w = uint64_t{};
+  auto w_digits = 0;
+  auto q = int64_t{};
+  auto truncated = false;
+  auto skip_truncated_digits = [&p, last, &truncated]() {
+    const auto* digits_first = p;
+    for (; p < last && is_digit(*p); ++p) {
+      truncated |= (*p != '0');
+    }
+    return p - digits_first;
+  };
+  if (*p == '0') {
+    ++p;
+  } else {
+    accumulate_digits(p, last, w, w_digits);
+    q += skip_truncated_digits();
+  }
+  if (p + 1 < last && *p == '.' && is_digit(p[1])) {
+    ++p;
+    if (w == 0) {
+      // Leading zeros are not significant.
+      const auto* zeros_first = p;
+      for (; p < last && *p == '0'; ++p) {}
+      q -= p - zeros_first;
+    }
+    q -= static_cast<int64_t>(accumulate_digits(p, last, w, w_digits));
+    skip_truncated_digits();
+  }
+  if (p < last && (*p == 'e' || *p == 'E')) {
+    const auto* e = p + 1;
+    auto exp_negative = false;
+    if (e < last && (*e == '+' || *e == '-')) {
+      exp_negative = (*e == '-');
+      ++e;
+    }
+    if (e < last && is_digit(*e)) {
+      auto exp = int64_t{};
+      for (; e < last && is_digit(*e); ++e) {
+        if (exp < 0x1'0000'0000) {
+          exp = exp * 10 + (*e - '0');
+        }
+      }
+      q += exp_negative ? -exp : exp;
+      p = e;
+    }
+  }
+
+  auto from_chars_fallback = [first, p, &value]() -> std::from_chars_result {
+    if consteval {
+      return {p, std::errc::not_supported};
+    } else {
+      return std::from_chars(first, p, value);
+    }
+  };
+  if constexpr (!std::is_same_v<FloatT, float> && !std::is_same_v<FloatT, double>) {
+    return from_chars_fallback();
+  } else {
+    using format = binary_format<FloatT>;
+    if (w == 0) {
+      value = negative ? -FloatT{0} : FloatT{0};
+      return {p, std::errc{}};
+    }
+    if constexpr (clinger_fast_path_enabled) {
+      // Both w and 10^|q| are exact, thus a single rounding gives the correct result.
+      if (!truncated && w <= format::max_mantissa_fast_path
+          && q >= -format::max_exponent_fast_path && q <= format::max_exponent_fast_path) {
+        auto res = static_cast<FloatT>(w);
+        if (q < 0) {
+          res /= format::exact_powers_of_ten[-q];
+        } else {
+          res *= format::exact_powers_of_ten[q];
+        }
+        value = negative ? -res : res;
+        return {p, std::errc{}};
+      }
+    }
+    auto am = compute_float<FloatT>(q, w);
+    // The exact value lies in [w, w + 1) * 10^q if truncated.
+    if (truncated && am != compute_float<FloatT>(q, w + 1)) {
+      return from_chars_fallback();
+    }
+    if (am.power2 == format::infinite_power || (am.power2 == 0 && am.mantissa == 0)) {
+      return {p, std::errc::result_out_of_range};
+    }
+    value = to_float<FloatT>(negative, am);
+    return {p, std::errc{}};
+  }
+}
+}  // namespace reflect_cpp26
+
+#endif  // REFLECT_CPP26_UTILS_NUMBER_PARSING_HPP
@@ -24,8 +24,12 @@
 #define REFLECT_CPP26_UTILS_STRING_BUILDER_HPP
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <charconv>
 #include <climits>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <reflect_cpp26/type_traits/arithmetic_types.hpp>
 #include <reflect_cpp26/utils/string_encoding.hpp>
@@ -36,9 +40,53 @@ class polymorphic_allocator;  // Defined in <memory_resource>
 }
 
 namespace reflect_cpp26 {
+namespace impl {
+// "00", "01", ..., "99"
+constexpr char decimal_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+constexpr auto decimal_powers_of_10 = []() {
+  auto res = std::array<uint64_t, 20>{1};
+  for (auto i = 1zU; i < res.size(); i++) {
+    res[i] = res[i - 1] * 10;
+  }
+  return res;
+}();
+
+constexpr size_t count_decimal_digits(uint64_t value) {
+  // 1233 / 4096 ~= log10(2)
+  auto t = (static_cast<size_t>(std::bit_width(value | 1)) * 1233) >> 12;
+  return t + 1 - ((value | 1) < decimal_powers_of_10[t]);
+}
+
+// Writes exactly n decimal digits of value backward from out + n, two digits at a time.
+template <class CharT, class UIntT>
+constexpr void write_decimal_digits(CharT* out, UIntT value, size_t n) {
+  auto* p = out + n;
+  while (value >= 100) {
+    auto i = static_cast<size_t>(value % 100) * 2;
+    value /= 100;
+    *--p = static_cast<CharT>(decimal_digit_pairs[i + 1]);
+    *--p = static_cast<CharT>(decimal_digit_pairs[i]);
+  }
+  if (value >= 10) {
+    auto i = static_cast<size_t>(value) * 2;
+    *--p = static_cast<CharT>(decimal_digit_pairs[i + 1]);
+    *--p = static_cast<CharT>(decimal_digit_pairs[i]);
+  } else {
+    *--p = static_cast<CharT>('0' + value);
+  }
+}
+}  // namespace impl
+
 template <char_type CharT, class Allocator = std::allocator<CharT>>
 class basic_string_builder {
 public:
+  // Receives the buffered characters when the builder is flushed.
+  using flush_handler_type = void (*)(void* context, const CharT* data, size_t length);
+
   constexpr basic_string_builder() : buffer_(nullptr), cur_(nullptr), end_(nullptr), alloc_() {}
 
   explicit constexpr basic_string_builder(Allocator alloc)
@@ -93,6 +141,14 @@ public:
     if (cur_ + n <= end_) [[likely]] {
       return *this;
     }
+    // With a flush handler, buffered content is handed over first and the buffer grows only if
+    // a single reservation exceeds its capacity.
+    if (flush_handler_ != nullptr) {
+      flush();
+      if (cur_ + n <= end_) {
+        return *this;
+      }
+    }
     auto cur_capacity = static_cast<size_t>(end_ - buffer_);
     auto new_capacity = cur_capacity + std::max<size_t>(cur_capacity, n);
 
@@ -105,6 +161,27 @@ public:
     return *this;
   }
 
+  // Installs a handler that receives buffered content whenever the buffer runs out of space,
+  // which makes the builder a bounded output buffer instead of a growing string.
+  // Content already handed over can not be unwound. str() and strview() only see the rest.
+  constexpr auto set_flush_handler(flush_handler_type handler, void* context)
+      -> basic_string_builder& {
+    flush_handler_ = handler;
+    flush_context_ = context;
+    return *this;
+  }
+
+  // Hands over all buffered content to the flush handler (if any) and clears the buffer.
+  constexpr auto flush() -> basic_string_builder& {
+    if (flush_handler_ != nullptr) {
+      if (cur_ != buffer_) {
+        flush_handler_(flush_context_, buffer_, static_cast<size_t>(cur_ - buffer_));
+      }
+      cur_ = buffer_;
+    }
+    return *this;
+  }
+
   constexpr auto unwind(size_t n = 1) -> basic_string_builder& {
     cur_ = std::max(cur_ - n, buffer_);
     return *this;
@@ -224,6 +301,18 @@ public:
     return *this;
   }
 
+  // Length N is known at compile time, thus the copy is a single fixed-size memcpy.
+  template <size_t N>
+  constexpr auto append_fixed_string_unsafe(const CharT* str) -> basic_string_builder& {
+    if consteval {
+      cur_ = std::ranges::copy_n(str, N, cur_).out;
+    } else {
+      std::memcpy(cur_, str, N * sizeof(CharT));
+      cur_ += N;
+    }
+    return *this;
+  }
+
   constexpr auto append_string(const CharT* str, const CharT* str_end) -> basic_string_builder& {
     reserve_at_least(str_end - str);
     return append_string_unsafe(str, str_end);
@@ -631,19 +720,57 @@ public:
 
   // -------- Append arithmetic types --------
 
-  constexpr auto append_bool(bool value) -> basic_string_builder& {
-    reserve_at_least(5);
+  constexpr auto append_bool_unsafe(bool value) -> basic_string_builder& {
     constexpr auto true_str = std::string_view{"true"};
     constexpr auto false_str = std::string_view{"false"};
     cur_ = std::ranges::copy(value ? true_str : false_str, cur_).out;
     return *this;
   }
 
+  constexpr auto append_bool(bool value) -> basic_string_builder& {
+    reserve_at_least(5);
+    return append_bool_unsafe(value);
+  }
+
+  // Remaining capacity must be enough for the result in given base.
+  template <non_bool_integral IntegerT>
+    requires(sizeof(IntegerT) <= sizeof(int64_t))
+  constexpr auto append_integer_unsafe(IntegerT value, int base = 10) -> basic_string_builder& {
+    if (base != 10) [[unlikely]] {
+      append_numeric_unsafe(value, base);
+      return *this;
+    }
+    // Decimal digits are generated directly into the buffer with the digit-pair table.
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+    using UIntT = std::conditional_t<sizeof(IntegerT) <= sizeof(uint32_t), uint32_t, uint64_t>;
+    auto magnitude = static_cast<UnsignedT>(value);
+    if constexpr (std::is_signed_v<IntegerT>) {
+      if (value < 0) {
+        *cur_++ = static_cast<CharT>('-');
+        magnitude = static_cast<UnsignedT>(UnsignedT{0} - magnitude);
+      }
+    }
+    auto n = impl::count_decimal_digits(magnitude);
+    impl::write_decimal_digits(cur_, static_cast<UIntT>(magnitude), n);
+    cur_ += n;
+    return *this;
+  }
+
   template <non_bool_integral IntegerT>
     requires(sizeof(IntegerT) <= sizeof(int64_t))
   constexpr auto append_integer(IntegerT value, int base = 10) -> basic_string_builder& {
-    constexpr size_t buffer_size = sizeof(IntegerT) * CHAR_BIT + 1;
-    append_numeric(buffer_size, value, base);
+    reserve_at_least(sizeof(IntegerT) * CHAR_BIT + 1);
+    return append_integer_unsafe(value, base);
+  }
+
+  // Remaining capacity must be enough for the shortest round-trip representation.
+  constexpr auto append_floating_point_unsafe(float value) -> basic_string_builder& {
+    append_numeric_unsafe(value);
+    return *this;
+  }
+
+  constexpr auto append_floating_point_unsafe(double value) -> basic_string_builder& {
+    append_numeric_unsafe(value);
     return *this;
   }
 
@@ -758,7 +885,11 @@ private:
   template <class... Args>
   constexpr void append_numeric(size_t buffer_size, Args... args) {
     reserve_at_least(buffer_size);
+    append_numeric_unsafe(args...);
+  }
 
+  template <class... Args>
+  constexpr void append_numeric_unsafe(Args... args) {
     if constexpr (std::is_same_v<CharT, char>) {
       cur_ = std::to_chars(cur_, end_, args...).ptr;
     } else if constexpr (std::is_same_v<CharT, char8_t>) {
@@ -862,6 +993,8 @@ private:
   CharT* cur_;
   CharT* end_;
   [[no_unique_address]] Allocator alloc_;
+  flush_handler_type flush_handler_ = nullptr;
+  void* flush_context_ = nullptr;
 };
 
 #define REFLECT_CPP26_STRING_BUILDER_ALIAS(string_type, CharT) \
@@ -23,6 +23,8 @@
 #ifndef REFLECT_CPP26_UTILS_STRING_HASH_HPP
 #define REFLECT_CPP26_UTILS_STRING_HASH_HPP
 
+#include <bit>
+#include <cstdint>
 #include <cwctype>
 #include <reflect_cpp26/type_traits/string_like_types.hpp>
 #include <reflect_cpp26/type_traits/type_comparison.hpp>
@@ -33,6 +35,33 @@
 namespace reflect_cpp26 {
 namespace impl {
 constexpr auto bkdr_hash_p = 131zU;
+
+constexpr auto xxh64_p1 = uint64_t{0x9E3779B185EBCA87};
+constexpr auto xxh64_p2 = uint64_t{0xC2B2AE3D27D4EB4F};
+constexpr auto xxh64_p3 = uint64_t{0x165667B19E3779F9};
+constexpr auto xxh64_p4 = uint64_t{0x85EBCA77C2B2AE63};
+constexpr auto xxh64_p5 = uint64_t{0x27D4EB2F165667C5};
+
+// Little-endian load regardless of platform endianness.
+template <size_t N>
+constexpr auto xxh64_read(const char* p) -> uint64_t {
+  auto res = uint64_t{0};
+  for (auto i = 0zU; i < N; i++) {
+    res |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+  }
+  return res;
+}
+
+constexpr auto xxh64_round(uint64_t acc, uint64_t input) -> uint64_t {
+  acc += input * xxh64_p2;
+  acc = std::rotl(acc, 31);
+  return acc * xxh64_p1;
+}
+
+constexpr auto xxh64_merge_round(uint64_t acc, uint64_t value) -> uint64_t {
+  acc ^= xxh64_round(0, value);
+  return acc * xxh64_p1 + xxh64_p4;
+}
 }  // namespace impl
 
 struct bkdr_hash_t {
@@ -70,8 +99,66 @@ struct ascii_ci_bkdr_hash_t {
   }
 };
 
+/**
+ * XXH64, which has much better distribution than BKDR hash and is used where collision
+ * matters (e.g. schema fingerprints). Input is hashed by bytes.
+ */
+struct xxh64_hash_t {
+  static constexpr auto operator()(const char* begin, const char* end, uint64_t seed = 0)
+      -> uint64_t {
+    using namespace impl;
+    auto len = static_cast<uint64_t>(end - begin);
+    auto h = uint64_t{};
+    if (len >= 32) {
+      auto v1 = seed + xxh64_p1 + xxh64_p2;
+      auto v2 = seed + xxh64_p2;
+      auto v3 = seed;
+      auto v4 = seed - xxh64_p1;
+      for (; end - begin >= 32; begin += 32) {
+        v1 = xxh64_round(v1, xxh64_read<8>(begin));
+        v2 = xxh64_round(v2, xxh64_read<8>(begin + 8));
+        v3 = xxh64_round(v3, xxh64_read<8>(begin + 16));
+        v4 = xxh64_round(v4, xxh64_read<8>(begin + 24));
+      }
+      h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+      h = xxh64_merge_round(h, v1);
+      h = xxh64_merge_round(h, v2);
+      h = xxh64_merge_round(h, v3);
+      h = xxh64_merge_round(h, v4);
+    } else {
+      h = seed + xxh64_p5;
+    }
+    h += len;
+    for (; end - begin >= 8; begin += 8) {
+      h ^= xxh64_round(0, xxh64_read<8>(begin));
+      h = std::rotl(h, 27) * xxh64_p1 + xxh64_p4;
+    }
+    if (end - begin >= 4) {
+      h ^= xxh64_read<4>(begin) * xxh64_p1;
+      h = std::rotl(h, 23) * xxh64_p2 + xxh64_p3;
+      begin += 4;
+    }
+    for (; begin < end; ++begin) {
+      h ^= static_cast<unsigned char>(*begin) * xxh64_p5;
+      h = std::rotl(h, 11) * xxh64_p1;
+    }
+    // Avalanche
+    h ^= h >> 33;
+    h *= xxh64_p2;
+    h ^= h >> 29;
+    h *= xxh64_p3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  static constexpr auto operator()(std::string_view str, uint64_t seed = 0) -> uint64_t {
+    return operator()(str.data(), str.data() + str.size(), seed);
+  }
+};
+
 constexpr auto bkdr_hash = bkdr_hash_t{};
 constexpr auto ascii_ci_bkdr_hash = ascii_ci_bkdr_hash_t{};
+constexpr auto xxh64_hash = xxh64_hash_t{};
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_UTILS_STRING_HASH_HPP
@@ -29,6 +29,10 @@ namespace reflect_cpp26 {
 struct ascii_case_insensitive_tag_t {};
 
 constexpr auto ascii_case_insensitive = ascii_case_insensitive_tag_t{};
+
+struct jump_table_tag_t {};
+
+constexpr auto jump_table = jump_table_tag_t{};
 }  // namespace reflect_cpp26
 
 #endif  // REFLECT_CPP26_UTILS_TAGS_HPP
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <reflect_cpp26/enum/enum_bitset.hpp>
+#include <vector>
+
+#include "tests/enum/test_cases.hpp"
+#include "tests/test_options.hpp"
+
+using namespace reflect_cpp26;
+using enum enum_entry_order;
+
+template <class E, enum_entry_order Order>
+constexpr auto to_vector(const enum_bitset<E, Order>& bits) {
+  return std::vector<E>(bits.begin(), bits.end());
+}
+
+TEST(EnumBitset, Basic) {
+  using E = foo_signed_rep;
+  EXPECT_EQ_STATIC(9, enum_bitset<E>::size());
+  EXPECT_EQ_STATIC(0, enum_bitset<empty>::size());
+
+  constexpr auto bits = enum_bitset<E>{E::one, E::two, E::invalid};
+  EXPECT_EQ_STATIC(3, bits.count());
+  EXPECT_TRUE_STATIC(bits.test(E::one));
+  EXPECT_TRUE_STATIC(bits.test(E::yi));
+  EXPECT_TRUE_STATIC(bits.test(E::er));
+  EXPECT_TRUE_STATIC(bits.contains(E::invalid));
+  EXPECT_FALSE_STATIC(bits.test(E::zero));
+  EXPECT_FALSE_STATIC(bits.test(static_cast<E>(3)));
+  EXPECT_TRUE_STATIC(bits.any());
+  EXPECT_FALSE_STATIC(bits.all());
+  EXPECT_FALSE_STATIC(bits.none());
+
+  EXPECT_EQ_STATIC(6, (~bits).count());
+  EXPECT_TRUE_STATIC((bits | ~bits).all());
+  EXPECT_TRUE_STATIC((bits & ~bits).none());
+  EXPECT_EQ_STATIC(enum_bitset<E>{E::yi}, bits ^ enum_bitset<E>{E::er, E::invalid});
+}
+
+TEST(EnumBitset, Modify) {
+  using E = bar_unsigned;
+  auto bits = enum_bitset<E>{};
+  EXPECT_TRUE(bits.none());
+
+  bits.set(E::ten).set(E::error).set(static_cast<E>(4));
+  EXPECT_EQ(2, bits.count());
+  bits.flip(E::ten).flip(E::zero).flip(static_cast<E>(4));
+  EXPECT_EQ((enum_bitset<E>{E::zero, E::error}), bits);
+  bits.reset(E::zero);
+  EXPECT_EQ((enum_bitset<E>{E::error}), bits);
+
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  EXPECT_EQ(11, bits.count());
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+}
+
+TEST(EnumBitset, Iteration) {
+  using E = foo_signed_rep;
+  EXPECT_EQ_STATIC(
+      (std::vector{E::zero, E::one, E::two, E::seven, E::error}),
+      to_vector(enum_bitset<E, original>{E::zero, E::yi, E::er, E::seven, E::error}));
+  EXPECT_EQ_STATIC(
+      (std::vector{E::error, E::zero, E::one, E::two, E::seven}),
+      to_vector(enum_bitset<E, by_value>{E::zero, E::yi, E::er, E::seven, E::error}));
+  EXPECT_EQ_STATIC(
+      (std::vector{E::er, E::error, E::one, E::seven, E::zero}),
+      to_vector(enum_bitset<E, by_name>{E::zero, E::yi, E::er, E::seven, E::error}));
+  EXPECT_EQ_STATIC(std::vector<E>{}, to_vector(enum_bitset<E>{}));
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <array>
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <vector>
+
+#include "tests/enum/test_cases.hpp"
+#include "tests/test_options.hpp"
+
+using namespace reflect_cpp26;
+
+TEST(EnumCastMany, FromString) {
+  constexpr auto inputs = std::array<std::string_view, 6>{
+      "zero", "yi", "error", "ZERO", "", "seven"};
+  auto outputs = std::vector<std::optional<foo_signed_rep>>(6);
+  EXPECT_EQ(4, enum_cast_many<foo_signed_rep>(inputs, outputs));
+  EXPECT_EQ(foo_signed_rep::zero, outputs[0]);
+  EXPECT_EQ(foo_signed_rep::one, outputs[1]);
+  EXPECT_EQ(foo_signed_rep::error, outputs[2]);
+  EXPECT_EQ(std::nullopt, outputs[3]);
+  EXPECT_EQ(std::nullopt, outputs[4]);
+  EXPECT_EQ(foo_signed_rep::seven, outputs[5]);
+
+  // Only min(inputs.size(), outputs.size()) entries are converted.
+  auto outputs_2 = std::vector<std::optional<foo_signed_rep>>(2);
+  EXPECT_EQ(2, enum_cast_many<foo_signed_rep>(inputs, outputs_2));
+  EXPECT_EQ(foo_signed_rep::zero, outputs_2[0]);
+  EXPECT_EQ(foo_signed_rep::one, outputs_2[1]);
+}
+
+TEST(EnumCastMany, FromStringCI) {
+  constexpr auto inputs = std::array<std::string_view, 4>{"ZERO", "Ten", "eleven", "twenty"};
+  auto outputs = std::array<std::optional<bar_unsigned>, 4>{};
+  EXPECT_EQ(3, enum_cast_many<bar_unsigned>(ascii_case_insensitive, inputs, outputs));
+  EXPECT_EQ(bar_unsigned::zero, outputs[0]);
+  EXPECT_EQ(bar_unsigned::ten, outputs[1]);
+  EXPECT_EQ(bar_unsigned::eleven, outputs[2]);
+  EXPECT_EQ(std::nullopt, outputs[3]);
+}
+
+TEST(EnumCastMany, FromInteger) {
+  constexpr auto inputs = std::array<int16_t, 5>{0, 3, 4, -1, -2};
+  auto outputs = std::array<std::optional<baz_signed>, 5>{};
+  EXPECT_EQ(3, enum_cast_many<baz_signed>(inputs, outputs));
+  EXPECT_EQ(baz_signed::ling, outputs[0]);
+  EXPECT_EQ(baz_signed::san, outputs[1]);
+  EXPECT_EQ(std::nullopt, outputs[2]);
+  EXPECT_EQ(baz_signed::fuyi, outputs[3]);
+  EXPECT_EQ(std::nullopt, outputs[4]);
+}
@@ -352,3 +352,30 @@ TEST(EnumCastFromInteger, HashCollision) {
   EXPECT_TRUE_STATIC(enum_contains<hash_collision>(1));
   EXPECT_FALSE_STATIC(enum_contains<hash_collision>(-1));
 }
+
+TEST(EnumContainsInteger, Membership) {
+  constexpr const auto& foo = impl::enum_membership_v<foo_signed>;
+  static_assert(foo.min_key == -2);
+  static_assert(foo.n_bits == 10);
+  static_assert(foo.outliers.empty());
+
+  constexpr const auto& qux = impl::enum_membership_v<qux_unsigned>;
+  static_assert(qux.min_key == 0);
+  static_assert(qux.n_bits == 5);
+  static_assert(qux.outliers.size() == 1);
+  EXPECT_TRUE_STATIC(enum_contains<qux_unsigned>(65535));
+  EXPECT_FALSE_STATIC(enum_contains<qux_unsigned>(65534));
+  EXPECT_FALSE_STATIC(enum_contains<qux_unsigned>(5));
+  EXPECT_FALSE_STATIC(enum_contains<qux_unsigned>(-1));
+
+  static_assert(impl::enum_membership_v<empty>.n_bits == 0);
+  EXPECT_FALSE_STATIC(enum_contains<empty>(0));
+  EXPECT_TRUE_STATIC(enum_contains<single>(233));
+  EXPECT_FALSE_STATIC(enum_contains<single>(232));
+  EXPECT_FALSE_STATIC(enum_contains<single>(234));
+
+  // Large sparse enum: most of the entries are outliers.
+  EXPECT_TRUE_STATIC(enum_contains<color>(0xF0F8FF));
+  EXPECT_TRUE_STATIC(enum_contains<color>(0x9ACD32));
+  EXPECT_FALSE_STATIC(enum_contains<color>(0x9ACD33));
+}
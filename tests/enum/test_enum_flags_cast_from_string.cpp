@@ -20,6 +20,7 @@
  * SOFTWARE.
  **/
 
+#include <array>
 #include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
 #include <reflect_cpp26/enum/enum_flags_cast.hpp>
 
@@ -104,3 +105,35 @@ TEST(EnumFlagsCastFromString, Empty) {
   EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<empty>("empty"));
   EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<empty>("| | |", ' '));
 }
+
+TEST(EnumFlagsCastFromString, Tokenizer) {
+  using namespace rfl::enum_bitwise_operators;
+  // Internal spaces are kept as part of the token
+  EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<D1>("one|tw o"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<D1>("one|two\tfour|eight"));
+  // Leftmost non-overlapping match of delimiter, the same as std::views::split
+  EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<D1>("one|||two", "||"));
+  EXPECT_EQ_STATIC(D1::one | D1::two, rfl::enum_flags_cast<D1>("one||||two", "||"));
+  EXPECT_EQ_STATIC(D1::one | D1::two, rfl::enum_flags_cast<D1>("one |||| two ||", "||"));
+  // Prefix of delimiter at the end
+  EXPECT_EQ_STATIC(std::nullopt, rfl::enum_flags_cast<D1>("one||two|", "||"));
+}
+
+TEST(EnumFlagsCastFromString, Many) {
+  using namespace rfl::enum_bitwise_operators;
+  constexpr auto inputs = std::array<std::string_view, 5>{
+      "one|two", " four ", "", "one|three", "eight | one"};
+  auto outputs = std::array<std::optional<D1>, 5>{};
+  EXPECT_EQ(4, rfl::enum_flags_cast_many<D1>(inputs, outputs));
+  EXPECT_EQ(D1::one | D1::two, outputs[0]);
+  EXPECT_EQ(D1::four, outputs[1]);
+  EXPECT_EQ(static_cast<D1>(0), outputs[2]);
+  EXPECT_EQ(std::nullopt, outputs[3]);
+  EXPECT_EQ(D1::eight | D1::one, outputs[4]);
+
+  auto outputs_2 = std::array<std::optional<D1>, 3>{};
+  EXPECT_EQ(2, rfl::enum_flags_cast_many<D1>(inputs, outputs_2, ", "));
+  EXPECT_EQ(std::nullopt, outputs_2[0]);
+  EXPECT_EQ(D1::four, outputs_2[1]);
+  EXPECT_EQ(static_cast<D1>(0), outputs_2[2]);
+}
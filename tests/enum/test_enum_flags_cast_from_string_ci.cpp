@@ -20,6 +20,7 @@
  * SOFTWARE.
  **/
 
+#include <array>
 #include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
 #include <reflect_cpp26/enum/enum_flags_cast.hpp>
 
@@ -113,3 +114,14 @@ TEST(EnumFlagsCastFromStringCI, Empty) {
   EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast_ci<empty>("empty"));
   EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast_ci<empty>("| | |", ' '));
 }
+
+TEST(EnumFlagsCastFromStringCI, Many) {
+  using namespace rfl::enum_bitwise_operators;
+  constexpr auto inputs = std::array<std::string_view, 4>{"ONE|Two", " fOUR ", "one|three", ""};
+  auto outputs = std::array<std::optional<D1>, 4>{};
+  EXPECT_EQ(3, rfl::enum_flags_cast_many<D1>(rfl::ascii_case_insensitive, inputs, outputs));
+  EXPECT_EQ(D1::one | D1::two, outputs[0]);
+  EXPECT_EQ(D1::four, outputs[1]);
+  EXPECT_EQ(std::nullopt, outputs[2]);
+  EXPECT_EQ(static_cast<D1>(0), outputs[3]);
+}
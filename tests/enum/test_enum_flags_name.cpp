@@ -20,6 +20,7 @@
  * SOFTWARE.
  **/
 
+#include <algorithm>
 #include <climits>
 #include <list>
 #include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
@@ -544,3 +545,41 @@ TEST(EnumFlagsName, D3ToStringBuilder) {
   EXPECT_EQ(rfl::to_string_status::done, status);
   EXPECT_EQ("SECOND|FIRST|THIRD", builder.strview());
 }
+
+template <class E>
+void test_name_table_consistency() {
+  constexpr auto full_set = rfl::impl::enum_flags_decomposer_v<E>.full_set;
+  for (auto v = 0zU; v <= full_set + 1; v++) {
+    auto flags = static_cast<E>(v);
+    auto expected = rfl::enum_flags_name(flags, ';').transform([](std::string s) {
+      std::ranges::replace(s, ';', '|');
+      return s;
+    });
+    EXPECT_EQ(expected, rfl::enum_flags_name(flags)) << "v = " << v;
+    EXPECT_EQ(expected, rfl::enum_flags_name(flags, "|")) << "v = " << v;
+
+    auto builder = rfl::string_builder{};
+    auto status = rfl::enum_flags_name_to(builder, flags);
+    if (expected.has_value()) {
+      EXPECT_EQ(rfl::to_string_status::done, status);
+      EXPECT_EQ(*expected, builder.strview());
+    } else {
+      EXPECT_EQ(rfl::to_string_status::invalid_input, status);
+    }
+  }
+}
+
+TEST(EnumFlagsName, NameTable) {
+  static_assert(rfl::impl::enum_flags_has_name_table_v<D1>);
+  static_assert(rfl::impl::enum_flags_has_name_table_v<D2>);
+  static_assert(rfl::impl::enum_flags_has_name_table_v<D3>);
+  static_assert(rfl::impl::enum_flags_has_name_table_v<D4>);
+  static_assert(NOT rfl::impl::enum_flags_has_name_table_v<D5>);  // Full set too large
+  static_assert(NOT rfl::impl::enum_flags_has_name_table_v<E1>);  // Irregular
+  static_assert(NOT rfl::impl::enum_flags_has_name_table_v<empty>);
+
+  test_name_table_consistency<D1>();
+  test_name_table_consistency<D2>();
+  test_name_table_consistency<D3>();
+  test_name_table_consistency<D4>();
+}
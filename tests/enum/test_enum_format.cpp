@@ -58,3 +58,17 @@ TEST(EnumFormat, Flags) {
   EXPECT_EQ("", std::format("{:F}", static_cast<foo_t>(0)));
   EXPECT_EQ("(foo_t)-10", std::format("{:F}", static_cast<foo_t>(-10)));
 }
+
+TEST(EnumFormat, FormatTo) {
+  auto str = std::string{"prefix:"};
+  std::format_to(std::back_inserter(str), "{},{:F}", foo_t::two, foo_t::eight);
+  EXPECT_EQ("prefix:two,eight", str);
+
+  // Delimiter too long to fit flag names in stack buffer
+  auto long_delim = std::string(200, '-');
+  auto fmt_str = "{:F" + long_delim + "}";
+  EXPECT_THAT(std::vformat(fmt_str, std::make_format_args(static_cast<foo_t>(15))),
+              testing::AnyOf("eight" + long_delim + "seven",
+                             "eight" + long_delim + "four" + long_delim + "two" + long_delim
+                                 + "one"));
+}
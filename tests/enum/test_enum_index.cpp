@@ -333,3 +333,12 @@ TEST(EnumIndex, HashCollision) {
   ASSERT_EQ_STATIC(npos, enum_index_by<by_value>(static_cast<hash_collision>(2)));
   ASSERT_EQ_STATIC(npos, enum_index_by<by_name>(static_cast<hash_collision>(123)));
 }
+
+TEST(EnumIndex, IndexWidth) {
+  static_assert(std::is_same_v<uint8_t, impl::enum_index_uint_t<foo_signed>>);
+  static_assert(std::is_same_v<uint8_t, impl::enum_index_uint_t<color>>);
+  static_assert(std::is_same_v<uint16_t, impl::enum_compact_uint_t<256>>);
+  static_assert(std::is_same_v<uint32_t, impl::enum_compact_uint_t<65536>>);
+  static_assert(sizeof(impl::enum_indices_t<impl::enum_index_uint_t<color>>) == 4);
+  ASSERT_EQ_STATIC(enum_count_v<color> - 1, enum_index_by<by_name>(color::yellow_green));
+}
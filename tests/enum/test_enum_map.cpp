@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <reflect_cpp26/enum/enum_map.hpp>
+#include <string>
+#include <vector>
+
+#include "tests/enum/test_cases.hpp"
+#include "tests/test_options.hpp"
+
+using namespace reflect_cpp26;
+using enum enum_entry_order;
+
+template <class E, enum_entry_order Order, class V>
+constexpr auto keys_of(const enum_map<E, V, Order>& map) {
+  auto res = std::vector<E>{};
+  for (auto [k, _] : map) {
+    res.push_back(k);
+  }
+  return res;
+}
+
+constexpr auto make_foo_signed_rep_map() {
+  auto map = enum_map<foo_signed_rep, int>{};
+  map[foo_signed_rep::zero] = 10;
+  map[foo_signed_rep::one] += 1;
+  map[foo_signed_rep::yi] += 2;  // Same as foo_signed_rep::one
+  map[foo_signed_rep::error] = -2;
+  return map;
+}
+
+TEST(EnumMap, Basic) {
+  EXPECT_EQ_STATIC(9, enum_map<foo_signed_rep, int>::size());
+  EXPECT_EQ_STATIC(11, enum_map<bar_unsigned, int>::size());
+  EXPECT_EQ_STATIC(0, enum_map<empty, int>::size());
+  EXPECT_EQ_STATIC(1, enum_map<single_rep, int>::size());
+
+  constexpr auto map = make_foo_signed_rep_map();
+  EXPECT_EQ_STATIC(10, map[foo_signed_rep::zero]);
+  EXPECT_EQ_STATIC(3, map[foo_signed_rep::one]);
+  EXPECT_EQ_STATIC(3, map[foo_signed_rep::yi]);
+  EXPECT_EQ_STATIC(0, map[foo_signed_rep::two]);
+  EXPECT_EQ_STATIC(-2, map[foo_signed_rep::error]);
+
+  EXPECT_TRUE_STATIC(map.contains(foo_signed_rep::er));
+  EXPECT_FALSE_STATIC(map.contains(static_cast<foo_signed_rep>(3)));
+  EXPECT_EQ_STATIC(10, map.find(foo_signed_rep::zero).value_or(0));
+  EXPECT_EQ_STATIC(std::nullopt, map.find(static_cast<foo_signed_rep>(3)));
+}
+
+TEST(EnumMap, Modify) {
+  auto map = enum_map<bar_unsigned, std::string>{"<init>"};
+  EXPECT_EQ("<init>", map[bar_unsigned::ten]);
+
+  map[bar_unsigned::ten] += "<ten>";
+  EXPECT_EQ("<init><ten>", map[bar_unsigned::ten]);
+
+  auto p = map.find(bar_unsigned::error);
+  ASSERT_TRUE(p.has_value());
+  *p = "<error>";
+  EXPECT_EQ("<error>", map[bar_unsigned::error]);
+  EXPECT_EQ("<error>", map.values()[9]);  // enum_unique_index(bar_unsigned::error) == 9
+  EXPECT_FALSE(map.find(static_cast<bar_unsigned>(4)).has_value());
+
+  map.fill("");
+  EXPECT_EQ("", map[bar_unsigned::ten]);
+  EXPECT_EQ(map, (enum_map<bar_unsigned, std::string>{}));
+}
+
+TEST(EnumMap, Iteration) {
+  using E = foo_signed_rep;
+  EXPECT_EQ_STATIC((std::vector{E::zero, E::one, E::two, E::four, E::five, E::six, E::seven,
+                                E::invalid, E::error}),
+                   keys_of(enum_map<E, int, original>{}));
+  EXPECT_EQ_STATIC((std::vector{E::error, E::invalid, E::zero, E::one, E::two, E::four, E::five,
+                                E::six, E::seven}),
+                   keys_of(enum_map<E, int, by_value>{}));
+  EXPECT_EQ_STATIC((std::vector{E::er, E::error, E::five, E::four, E::invalid, E::one, E::seven,
+                                E::six, E::zero}),
+                   keys_of(enum_map<E, int, by_name>{}));
+  EXPECT_EQ_STATIC(std::vector<empty>{}, keys_of(enum_map<empty, int>{}));
+
+  auto map = enum_map<E, int, by_value>{};
+  for (auto [k, v] : map) {
+    v = static_cast<int>(k) * 10;
+  }
+  EXPECT_EQ(-20, map[E::error]);
+  EXPECT_EQ(20, map[E::er]);
+  EXPECT_EQ(70, map[E::seven]);
+}
@@ -32,3 +32,29 @@ TEST(EnumNames, All) {
   EXPECT_EQ_STATIC("four", enum_names_v<const foo_signed_rep, enum_entry_order::by_value>[7]);
   EXPECT_EQ_STATIC("yi", enum_names_v<volatile foo_signed_rep, enum_entry_order::by_name>[9]);
 }
+
+template <class E>
+constexpr bool names_are_pooled() {
+  const auto& pool = impl::enum_name_pool_v<E>;
+  auto names = enum_names_v<E>;
+  for (auto i = 0zU; i < names.size(); i++) {
+    auto expected_begin = (i == 0) ? pool.head : names[i - 1].data() + names[i - 1].size() + 1;
+    if (names[i].data() != expected_begin || names[i].data()[names[i].size()] != '\0') {
+      return false;
+    }
+  }
+  auto pool_end = pool.head + pool.n;
+  return std::ranges::all_of(enum_names_v<E, enum_entry_order::by_name>, [&](auto name) {
+    return name.data() >= pool.head && name.data() + name.size() <= pool_end;
+  });
+}
+
+TEST(EnumNames, Pool) {
+  EXPECT_TRUE_STATIC(names_are_pooled<foo_signed_rep>());
+  EXPECT_TRUE_STATIC(names_are_pooled<color>());
+  EXPECT_TRUE_STATIC(names_are_pooled<empty>());
+  EXPECT_EQ_STATIC(0, impl::enum_name_pool_v<empty>.n);
+
+  static_assert(std::is_same_v<uint8_t, impl::enum_name_offset_t<foo_signed_rep>>);
+  static_assert(std::is_same_v<uint16_t, impl::enum_name_offset_t<color>>);
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <reflect_cpp26/enum/enum_name.hpp>
+#include <vector>
+
+#include "tests/enum/test_cases.hpp"
+#include "tests/test_options.hpp"
+
+using namespace reflect_cpp26;
+
+TEST(EnumNamesTo, Basic) {
+  auto values = std::vector{
+      bar_unsigned::zero, bar_unsigned::ten, bar_unsigned::error, bar_unsigned::fourteen};
+  auto builder = string_builder{};
+  EXPECT_EQ(4, enum_names_to(builder, values));
+  EXPECT_EQ("zero,ten,error,fourteen", builder.strview());
+
+  builder.append_char('\n');
+  EXPECT_EQ(2, enum_names_to(builder, std::span{values}.first(2), ", "));
+  EXPECT_EQ("zero,ten,error,fourteen\nzero, ten", builder.strview());
+}
+
+TEST(EnumNamesTo, InvalidValues) {
+  auto values = std::vector{foo_signed::one, static_cast<foo_signed>(3), foo_signed::error};
+  auto builder = string_builder{};
+  EXPECT_EQ(2, enum_names_to(builder, values, '|'));
+  EXPECT_EQ("one||error", builder.strview());
+}
+
+TEST(EnumNamesTo, Empty) {
+  auto builder = string_builder{};
+  EXPECT_EQ(0, enum_names_to(builder, std::vector<terminal_color>{}));
+  EXPECT_EQ("", builder.strview());
+  EXPECT_EQ(0, enum_names_to(builder, std::vector{static_cast<empty>(0)}));
+  EXPECT_EQ("", builder.strview());
+}
@@ -142,3 +142,51 @@ TEST(EnumSwitch, Dereference) {
   EXPECT_EQ("<n/a><changed>", str2);
   EXPECT_EQ("<n/a>", default_str);
 }
+
+struct to_underlying_t {
+  static constexpr auto operator()(auto ec) {
+    return std::to_underlying(ec.value);
+  }
+};
+
+TEST(EnumSwitch, JumpTableWithReturnValue) {
+  constexpr auto res_1 =
+      enum_switch<int>(jump_table, underlying_pow_t<foo_signed, 2>{}, foo_signed::four);
+  EXPECT_EQ_STATIC(16, res_1);
+  constexpr auto res_2 =
+      enum_switch<int>(jump_table, underlying_pow_t<foo_signed_rep, 3>{}, foo_signed_rep::er);
+  EXPECT_EQ_STATIC(8, res_2);
+  constexpr auto res_3 =
+      enum_switch<int>(jump_table, underlying_pow_t<foo_signed, 2>{}, static_cast<foo_signed>(3));
+  EXPECT_EQ_STATIC(std::nullopt, res_3);
+  constexpr auto res_4 =
+      enum_switch<int>(jump_table, underlying_pow_t<foo_signed, 2>{}, static_cast<foo_signed>(8));
+  EXPECT_EQ_STATIC(std::nullopt, res_4);
+
+  // Sparse values with a lot of entries
+  EXPECT_EQ_STATIC(0xFF7F50, enum_switch<uint32_t>(jump_table, to_underlying_t{}, color::coral));
+  EXPECT_EQ_STATIC(0x00FFFF, enum_switch<uint32_t>(jump_table, to_underlying_t{}, color::cyan));
+  EXPECT_EQ_STATIC(std::nullopt,
+                   enum_switch<uint32_t>(jump_table, to_underlying_t{}, static_cast<color>(1)));
+  EXPECT_EQ_STATIC(13u, enum_switch(jump_table, to_underlying_t{}, bar_unsigned::thirteen, 0u));
+  EXPECT_EQ_STATIC(0u,
+                   enum_switch(jump_table, to_underlying_t{}, static_cast<bar_unsigned>(4), 0u));
+}
+
+TEST(EnumSwitch, JumpTableWithoutReturnValue) {
+  auto res = std::string{};
+  enum_switch(jump_table, underlying_to_string_t{&res}, bar_unsigned::eleven);
+  EXPECT_EQ("<match> 11", res);
+  enum_switch(jump_table, underlying_to_string_t{&res}, static_cast<bar_unsigned>(4));
+  EXPECT_EQ("<match> 11", res);  // No change
+
+  auto fallback = [&res](array_index value) {
+    res = "<invalid> " + std::to_string(std::to_underlying(value));
+  };
+  enum_switch(jump_table, underlying_to_string_t{&res}, fallback, array_index::three);
+  EXPECT_EQ("<match> 3", res);
+  enum_switch(jump_table, underlying_to_string_t{&res}, fallback, static_cast<array_index>(4));
+  EXPECT_EQ("<invalid> 4", res);
+  enum_switch(jump_table, underlying_to_string_t{&res}, fallback, static_cast<array_index>(-1));
+  EXPECT_EQ("<invalid> -1", res);
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <reflect_cpp26/type_operations/class_schema_hash.hpp>
+#include <string>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+namespace test_class_schema_hash {
+enum class level_t : uint8_t {
+  low,
+  high,
+};
+
+enum class level_renamed_t : uint8_t {
+  low,
+  very_high,
+};
+
+struct point_t {
+  int32_t x;
+  int32_t y;
+};
+
+struct point_same_t {
+  int32_t x;
+  int32_t y;
+};
+
+struct point_renamed_t {
+  int32_t x;
+  int32_t z;
+};
+
+struct point_reordered_t {
+  int32_t y;
+  int32_t x;
+};
+
+struct point_widened_t {
+  int64_t x;
+  int64_t y;
+};
+
+struct record_t {
+  point_t pos;
+  level_t level;
+  double values[3];
+  std::string name;
+};
+
+struct record_renamed_enum_t {
+  point_t pos;
+  level_renamed_t level;
+  double values[3];
+  std::string name;
+};
+
+struct base_t {
+  uint16_t id;
+};
+
+struct derived_t : base_t {
+  uint8_t flags : 3;
+  uint8_t mode : 5;
+};
+}  // namespace test_class_schema_hash
+
+TEST(TypeOperationsClassSchemaHash, Xxh64) {
+  EXPECT_EQ_STATIC(0xEF46DB3751D8E999, rfl::xxh64_hash(""));
+  EXPECT_EQ_STATIC(0x44BC2CF5AD770999, rfl::xxh64_hash("abc"));
+  EXPECT_EQ_STATIC(0xFBCEA83C8A378BF1, rfl::xxh64_hash("Nobody inspects the spammish repetition"));
+}
+
+TEST(TypeOperationsClassSchemaHash, Schema) {
+  using namespace test_class_schema_hash;
+  EXPECT_EQ_STATIC("{(8,4)x:i32@0;y:i32@32;}", std::string_view{rfl::class_schema_v<point_t>});
+  EXPECT_EQ_STATIC("{(4,2)id:u16@0;flags:u8@16/3;mode:u8@19/5;}",
+                   std::string_view{rfl::class_schema_v<derived_t>});
+}
+
+TEST(TypeOperationsClassSchemaHash, Equality) {
+  using namespace test_class_schema_hash;
+  // Only layout matters, not the class name.
+  EXPECT_EQ_STATIC(rfl::class_schema_hash_v<point_t>, rfl::class_schema_hash_v<point_same_t>);
+  EXPECT_EQ_STATIC(rfl::class_schema_fingerprint_v<point_t>,
+                   rfl::class_schema_fingerprint_v<const point_same_t>);
+
+  EXPECT_NE_STATIC(rfl::class_schema_hash_v<point_t>, rfl::class_schema_hash_v<point_renamed_t>);
+  EXPECT_NE_STATIC(rfl::class_schema_hash_v<point_t>, rfl::class_schema_hash_v<point_reordered_t>);
+  EXPECT_NE_STATIC(rfl::class_schema_hash_v<point_t>, rfl::class_schema_hash_v<point_widened_t>);
+  EXPECT_NE_STATIC(rfl::class_schema_hash_v<record_t>,
+                   rfl::class_schema_hash_v<record_renamed_enum_t>);
+
+  constexpr auto fp = rfl::class_schema_fingerprint_v<record_t>;
+  EXPECT_NE_STATIC(fp.low, fp.high);
+}
@@ -0,0 +1,641 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
+#include <reflect_cpp26/fixed_map/string_key.hpp>
+#include <reflect_cpp26/type_operations/deserialize_from_json.hpp>
+#include <reflect_cpp26/type_operations/serialize_to_json.hpp>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+enum class color_t {
+  red,
+  green,
+  blue,
+};
+
+enum class permissions_t : int {
+  read = 1,
+  write = 2,
+  execute = 4,
+};
+REFLECT_CPP26_DEFINE_ENUM_BITWISE_BINARY_OPERATORS(permissions_t)
+template <>
+constexpr auto rfl::is_enum_flag_v<permissions_t> = true;
+
+struct point_t {
+  int x;
+  int y;
+
+  bool operator==(const point_t&) const = default;
+};
+
+struct person_t {
+  std::string name;
+  int age = -1;
+  std::optional<std::string> email;
+  std::vector<point_t> path;
+  color_t favorite_color = color_t::red;
+
+  bool operator==(const person_t&) const = default;
+};
+
+struct base_t {
+  int id;
+};
+
+struct derived_t : base_t {
+  double score;
+  int counts[3];
+};
+
+struct prefixed_keys_t {
+  int a;
+  int ab;
+  int b;
+
+  bool operator==(const prefixed_keys_t&) const = default;
+};
+
+struct message_t {
+  std::string_view sender;
+  std::span<const std::string_view> tags;
+  std::span<point_t> path;
+  std::span<const std::span<const int>> matrix;
+  std::string owned;
+  int id;
+};
+
+struct pmr_message_t {
+  std::pmr::string topic;
+  std::pmr::vector<std::pmr::string> tags;
+  std::pmr::map<std::pmr::string, std::pmr::vector<int>> values;
+  std::optional<std::pmr::string> note;
+  std::tuple<std::pmr::string, int> record;
+  std::pmr::vector<std::tuple<std::pmr::string, int>> records;
+  int id;
+};
+
+// Counts allocations forwarded to new_delete_resource().
+class counting_resource : public std::pmr::memory_resource {
+public:
+  size_t n_allocations = 0;
+
+private:
+  auto do_allocate(size_t bytes, size_t alignment) -> void* override {
+    n_allocations += 1;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+struct everything_t {
+  bool flag;
+  char16_t letter;
+  uint8_t small;
+  int64_t big;
+  float ratio;
+  std::u8string title;
+  std::array<int, 2> range;
+  std::tuple<int, std::string, bool> record;
+  std::set<int> tags;
+  std::deque<std::list<double>> matrix;
+  std::map<std::string, point_t> named_points;
+  std::map<int, std::string> numbered;
+  std::variant<std::monostate, int, std::string> any;
+  std::optional<permissions_t> permissions;
+  std::vector<bool> bits;
+
+  bool operator==(const everything_t&) const = default;
+};
+
+TEST(TypeOperationsDeserializeFromJson, Scalars) {
+  EXPECT_EQ(42, rfl::deserialize_from_json<int>("42"));
+  EXPECT_EQ(-123, rfl::deserialize_from_json<int>(" -123 "));
+  EXPECT_EQ(UINT64_MAX, rfl::deserialize_from_json<uint64_t>("18446744073709551615"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<uint8_t>("256"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<unsigned>("-1"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<int>("1.5"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<int>("1e3"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<int>("012"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<int>("+1"));
+
+  EXPECT_EQ(3.14, rfl::deserialize_from_json<double>("3.14"));
+  EXPECT_EQ(-1250.0f, rfl::deserialize_from_json<float>("-1.25e3"));
+  EXPECT_EQ(7.0, rfl::deserialize_from_json<double>("7"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<double>("1."));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<double>(".5"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<double>("NaN"));
+
+  EXPECT_EQ(true, rfl::deserialize_from_json<bool>("true"));
+  EXPECT_EQ(false, rfl::deserialize_from_json<bool>("false"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<bool>("1"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<bool>("tru"));
+
+  // Character types: integers, or strings of one code unit
+  EXPECT_EQ('a', rfl::deserialize_from_json<char>("97"));
+  EXPECT_EQ('a', rfl::deserialize_from_json<char>(R"("a")"));
+  EXPECT_EQ(u'你', rfl::deserialize_from_json<char16_t>(R"("你")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<char>(R"("ab")"));
+
+  EXPECT_EQ(std::monostate{}, rfl::deserialize_from_json<std::monostate>("null"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::monostate>("0"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, Strings) {
+  EXPECT_EQ("hello", rfl::deserialize_from_json<std::string>(R"("hello")"));
+  EXPECT_EQ("", rfl::deserialize_from_json<std::string>(R"("")"));
+  EXPECT_EQ("a\"b\\c/\b\f\n\r\t", rfl::deserialize_from_json<std::string>(
+                                      R"("a\"b\\c\/\b\f\n\r\t")"));
+  EXPECT_EQ("\xe4\xbd\xa0\xf0\x9f\x98\x80",
+            rfl::deserialize_from_json<std::string>(R"("你😀")"));
+  EXPECT_EQ("\xe4\xbd\xa0", rfl::deserialize_from_json<std::string>("\"\xe4\xbd\xa0\""));
+
+  EXPECT_EQ(u"你\U0001F600x",
+            rfl::deserialize_from_json<std::u16string>("\"\xe4\xbd\xa0\\uD83D\\uDE00x\""));
+  EXPECT_EQ(U"你\U0001F600", rfl::deserialize_from_json<std::u32string>(
+                                     "\"\xe4\xbd\xa0\xf0\x9f\x98\x80\""));
+  EXPECT_EQ(L"é\n", rfl::deserialize_from_json<std::wstring>(R"("é\n")"));
+
+  // Malformed strings
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>(R"("abc)"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>(R"("\x")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>(R"("\u12G4")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>(R"("\uD83D")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>(R"("\uDE00")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>("\"tab\tinside\""));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::u16string>("\"\xff\""));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::string>("abc"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, Enums) {
+  EXPECT_EQ(color_t::green, rfl::deserialize_from_json<color_t>(R"("green")"));
+  EXPECT_EQ(color_t::blue, rfl::deserialize_from_json<color_t>("2"));
+  EXPECT_EQ(static_cast<color_t>(42), rfl::deserialize_from_json<color_t>("42"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<color_t>(R"("purple")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<color_t>(R"("GREEN")"));
+
+  constexpr auto opts = rfl::deserialize_options{.rejects_invalid_enum = true};
+  EXPECT_EQ(color_t::blue, (rfl::deserialize_from_json<color_t, opts>("2")));
+  EXPECT_EQ(std::nullopt, (rfl::deserialize_from_json<color_t, opts>("42")));
+
+  EXPECT_EQ(permissions_t::write, rfl::deserialize_from_json<permissions_t>(R"("write")"));
+  EXPECT_EQ(permissions_t::read | permissions_t::execute,
+            rfl::deserialize_from_json<permissions_t>(R"("read|execute")"));
+  EXPECT_EQ(permissions_t::read | permissions_t::write,
+            (rfl::deserialize_from_json<permissions_t, opts>("3")));
+  EXPECT_EQ(std::nullopt, (rfl::deserialize_from_json<permissions_t, opts>("8")));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<permissions_t>(R"("read|delete")"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, Containers) {
+  using ints_t = std::vector<int>;
+  EXPECT_EQ((ints_t{1, 2, 3}), rfl::deserialize_from_json<ints_t>("[1, 2 ,3]"));
+  EXPECT_EQ(ints_t{}, rfl::deserialize_from_json<ints_t>(" [ ] "));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<ints_t>("[1, 2,]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<ints_t>("[1 2]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<ints_t>("[1, 2"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<ints_t>("[1, 2] 3"));
+
+  using bools_t = std::vector<bool>;
+  EXPECT_EQ((bools_t{true, false}), rfl::deserialize_from_json<bools_t>("[true,false]"));
+
+  using strings_t = std::set<std::string>;
+  EXPECT_EQ((strings_t{"a", "b"}), rfl::deserialize_from_json<strings_t>(R"(["b","a","b"])"));
+
+  using object_t = std::map<std::string, int>;
+  EXPECT_EQ((object_t{{"a", 1}, {"b\n", 2}}),
+            rfl::deserialize_from_json<object_t>(R"({"a": 0, "b\n": 2, "a": 1})"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<object_t>(R"([["a", 1]])"));
+
+  // Maps with non-string keys and other associative containers are JSON nested arrays
+  using int_map_t = std::map<int, std::string>;
+  EXPECT_EQ((int_map_t{{1, "x"}, {2, "y"}}),
+            rfl::deserialize_from_json<int_map_t>(R"([[2, "y"], [1, "x"]])"));
+  using hash_map_t = std::unordered_map<std::string, int>;
+  EXPECT_EQ((hash_map_t{{"a", 1}}), rfl::deserialize_from_json<hash_map_t>(R"([["a", 1]])"));
+
+  using fixed_t = std::array<int, 3>;
+  EXPECT_EQ((fixed_t{4, 5, 6}), rfl::deserialize_from_json<fixed_t>("[4,5,6]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<fixed_t>("[4,5]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<fixed_t>("[4,5,6,7]"));
+
+  using tuple_t = std::tuple<int, std::string, std::pair<bool, double>>;
+  EXPECT_EQ((tuple_t{1, "one", {true, 0.5}}),
+            rfl::deserialize_from_json<tuple_t>(R"([1, "one", [true, 0.5]])"));
+  EXPECT_EQ(std::tuple<>{}, rfl::deserialize_from_json<std::tuple<>>("[]"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, OptionalAndVariant) {
+  using optional_t = std::optional<int>;
+  EXPECT_EQ(optional_t{std::nullopt}, rfl::deserialize_from_json<optional_t>("null"));
+  EXPECT_EQ(optional_t{5}, rfl::deserialize_from_json<optional_t>("5"));
+
+  // The first alternative that accepts the input is chosen.
+  using variant_t = std::variant<std::monostate, int, double, std::string, std::vector<int>>;
+  EXPECT_EQ(variant_t{}, rfl::deserialize_from_json<variant_t>("null"));
+  EXPECT_EQ(variant_t{1}, rfl::deserialize_from_json<variant_t>("1"));
+  EXPECT_EQ(variant_t{1.5}, rfl::deserialize_from_json<variant_t>("1.5"));
+  EXPECT_EQ(variant_t{"s"}, rfl::deserialize_from_json<variant_t>(R"("s")"));
+  EXPECT_EQ((variant_t{std::vector{1, 2}}), rfl::deserialize_from_json<variant_t>("[1,2]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<variant_t>("true"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, Structs) {
+  auto json = R"({
+    "name": "Alice",
+    "favorite_color": "blue",
+    "path": [{"x": 1, "y": 2}, {"y": 4, "x": 3}],
+    "age": 30
+  })";
+  auto expected = person_t{.name = "Alice",
+                           .age = 30,
+                           .email = std::nullopt,
+                           .path = {{1, 2}, {3, 4}},
+                           .favorite_color = color_t::blue};
+  EXPECT_EQ(expected, rfl::deserialize_from_json<person_t>(json));
+
+  // Escaped keys
+  EXPECT_EQ((point_t{5, 6}), rfl::deserialize_from_json<point_t>(R"({"x":5,"\u0079":6})"));
+  // Members absent from input keep their values
+  auto person = person_t{.name = "Bob", .age = 20};
+  ASSERT_TRUE(rfl::deserialize_from_json(person, R"({"email": "bob@example.com"})"));
+  EXPECT_EQ("Bob", person.name);
+  EXPECT_EQ(20, person.age);
+  EXPECT_EQ("bob@example.com", person.email);
+  // Inherited members and arrays
+  auto derived = rfl::deserialize_from_json<derived_t>(
+      R"({"score": 0.25, "id": 7, "counts": [1, 2, 3]})");
+  ASSERT_TRUE(derived.has_value());
+  EXPECT_EQ(7, derived->id);
+  EXPECT_EQ(0.25, derived->score);
+  EXPECT_EQ(3, derived->counts[2]);
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<derived_t>(R"({"counts": [1, 2]})"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, MemberOrder) {
+  using T = prefixed_keys_t;
+  // Declaration order, possibly with whitespaces before or after colons
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"a":1,"ab":2,"b":3})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({ "a" : 1, "ab": 2, "b" :3 })"));
+  // Mispredicted keys, which share prefixes with predicted ones
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"ab":2,"a":1,"b":3})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"b":3,"a":1,"ab":2})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"a":1,"abc":0,"ab":2,"b":3})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"a":1,"b":3,"ab":2})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"a":0,"b":3,"a":1,"ab":2})"));
+  EXPECT_EQ((T{1, 2, 3}), rfl::deserialize_from_json<T>(R"({"a":1,"\u0061b":2,"b":3})"));
+
+  constexpr auto complete = rfl::deserialize_options{.requires_all_members = true};
+  EXPECT_EQ((T{1, 2, 3}), (rfl::deserialize_from_json<T, complete>(R"({"a":1,"ab":2,"b":3})")));
+  EXPECT_EQ(std::nullopt, (rfl::deserialize_from_json<T, complete>(R"({"a":1,"ab":2,"a":3})")));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<T>(R"({"a":1,"ab"2,"b":3})"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<T>(R"({"a":1,"ab":,"b":3})"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, StructOptions) {
+  auto json = R"({"x": 1, "unknown": {"a": [1, "]", {"b": null}]}, "y": 2})";
+  EXPECT_EQ((point_t{1, 2}), rfl::deserialize_from_json<point_t>(json));
+
+  constexpr auto strict = rfl::deserialize_options{.ignores_unknown_keys = false};
+  EXPECT_EQ(std::nullopt, (rfl::deserialize_from_json<point_t, strict>(json)));
+  EXPECT_EQ((point_t{1, 2}), (rfl::deserialize_from_json<point_t, strict>(R"({"y":2,"x":1})")));
+
+  constexpr auto complete = rfl::deserialize_options{.requires_all_members = true};
+  EXPECT_EQ(std::nullopt, (rfl::deserialize_from_json<point_t, complete>(R"({"x":1,"x":2})")));
+  EXPECT_EQ((point_t{2, 3}),
+            (rfl::deserialize_from_json<point_t, complete>(R"({"x":1,"y":3,"x":2})")));
+
+  // Malformed values of unknown keys are rejected as well
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<point_t>(R"({"z": [1, }, "x": 1})"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<point_t>(R"({"x": 1,})"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<point_t>(R"({x: 1})"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, RoundTrip) {
+  auto value = everything_t{
+      .flag = true,
+      .letter = u'é',
+      .small = 255,
+      .big = INT64_MIN,
+      .ratio = 0.125f,
+      .title = u8"Title \"你\"\n",
+      .range = {-1, 1},
+      .record = {3, "three", false},
+      .tags = {3, 1, 2},
+      .matrix = {{1.5, -2.0}, {}, {1e-10}},
+      .named_points = {{"origin", {0, 0}}, {"a/b", {1, -1}}},
+      .numbered = {{1, "one"}, {-2, "minus two"}},
+      .any = "text",
+      .permissions = permissions_t::read | permissions_t::write,
+      .bits = {true, false, true},
+  };
+  auto json = rfl::serialize_to_json(value);
+  EXPECT_EQ(value, rfl::deserialize_from_json<everything_t>(json));
+  EXPECT_EQ(value, rfl::deserialize_from_json<everything_t>(rfl::serialize_to_json(value, 2)));
+
+  constexpr auto to_string = rfl::serialize_options{.char_to_string = true, .enum_to_string = true};
+  EXPECT_EQ(value, rfl::deserialize_from_json<everything_t>(
+                       rfl::serialize_to_json<char, to_string>(value)));
+
+  // Non-finite floating-point values are written as strings "NaN", "Infinity" and "-Infinity"
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  value.ratio = -std::numeric_limits<float>::infinity();
+  value.matrix = {{inf, -inf}, {std::numeric_limits<double>::quiet_NaN()}};
+  auto res = rfl::deserialize_from_json<everything_t>(rfl::serialize_to_json(value, 2));
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(value.ratio, res->ratio);
+  EXPECT_EQ((std::list<double>{inf, -inf}), res->matrix[0]);
+  ASSERT_EQ(1, res->matrix[1].size());
+  EXPECT_TRUE(std::isnan(res->matrix[1].front()));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<double>(R"("nan")"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<double>(R"("Infinity )"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, StructuralIndex) {
+  auto build = [](std::string_view json) -> std::optional<std::vector<uint32_t>> {
+    auto positions = std::vector<uint32_t>{};
+    if (!rfl::impl::json::build_json_structural_index(json, positions)) {
+      return std::nullopt;
+    }
+    return positions;
+  };
+  EXPECT_EQ((std::vector<uint32_t>{0, 1, 5, 6, 7, 8, 9, 10, 14, 15, 16, 17, 18, 19, 23}),
+            build(R"({"a\"":[1,true],"":-2.5})"));
+  EXPECT_EQ((std::vector<uint32_t>{}), build(" \t\r\n"));
+  EXPECT_EQ((std::vector<uint32_t>{0, 3}), build(R"("\\" )"));
+
+  // Strings and escape sequences across 64-byte blocks
+  auto json = std::string(62, ' ') + R"(["\\\"]\\"  ,  )" + std::string(100, 'x') + " ]";
+  EXPECT_EQ((std::vector<uint32_t>{62, 63, 71, 74, 77, 178}), build(json));
+
+  EXPECT_EQ(std::nullopt, build(R"(["abc)"));
+  EXPECT_EQ(std::nullopt, build(std::string(63, ' ') + "\"\\"));
+  EXPECT_EQ(std::nullopt, build("[\"tab\tinside\"]"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, LargeDocuments) {
+  auto people = std::vector<person_t>{};
+  for (auto i = 0; i < 100; i++) {
+    auto name = "Person \"" + std::to_string(i) + "\" " + std::string(i % 70, 'x');
+    auto email = (i % 3 == 0) ? std::nullopt : std::optional{name + "@example.com"};
+    auto path = std::vector<point_t>(i % 5, point_t{i, -i});
+    people.push_back({name, i, email, path, static_cast<color_t>(i % 3)});
+  }
+  auto json = rfl::serialize_to_json(people);
+  ASSERT_GE(json.size(), rfl::impl::json::json_structural_index_min_size);
+  EXPECT_EQ(people, rfl::deserialize_from_json<std::vector<person_t>>(json));
+  EXPECT_EQ(people, rfl::deserialize_from_json<std::vector<person_t>>(
+                        rfl::serialize_to_json(people, 4, '\t')));
+
+  auto large_string = std::string(5000, 'a') + "\"\\\n\t" + std::string(5000, 'b');
+  EXPECT_EQ(large_string,
+            rfl::deserialize_from_json<std::string>(rfl::serialize_to_json(large_string)));
+
+  // Malformed input found by stage one or stage two
+  auto padding = std::string(2000, ' ');
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::vector<person_t>>(json + padding + "x"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::vector<person_t>>(json + "\""));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::vector<int>>("[1" + padding + "2]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::vector<int>>("[1" + padding + "x]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::vector<int>>("[1x" + padding + "]"));
+  EXPECT_EQ(std::nullopt,
+            rfl::deserialize_from_json<std::vector<std::string>>("[\"\x01\"" + padding + "]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<point_t>(R"({"x":1,)" + padding + "}"));
+  EXPECT_EQ((point_t{1, 2}), rfl::deserialize_from_json<point_t>(
+                                 R"({"x":1,"z":[)" + padding + R"("\"]"],"y":2})"));
+
+  // Type mismatch: arrays and objects are not strings
+  using string_or_ints = std::variant<std::string, std::vector<int>>;
+  using strings = std::vector<std::string>;
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<strings>(R"([[],"a")" + padding + "]"));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<strings>(R"([{},"a")" + padding + "]"));
+  EXPECT_EQ(string_or_ints{std::vector<int>{}},
+            rfl::deserialize_from_json<string_or_ints>("[]" + padding));
+  EXPECT_EQ(std::nullopt, rfl::deserialize_from_json<std::map<std::string, int>>(
+                              R"({[]:1,"a":2)" + padding + "}"));
+}
+
+TEST(TypeOperationsDeserializeFromJson, InSitu) {
+  auto json = std::string{R"({
+    "sender": "Alice",
+    "tags": ["a\"b", "", "\u4f60\ud83d\ude00\n"],
+    "path": [{"x": 1, "y": 2}, {"x": 3, "y": 4}],
+    "matrix": [[1, 2], [], [3]],
+    "owned": "x\ty",
+    "id": 7
+  })"};
+  alignas(std::max_align_t) std::byte storage[256];
+  auto arena = rfl::json_arena{storage};
+  auto message = message_t{};
+  ASSERT_TRUE(rfl::deserialize_from_json_in_situ(message, json, arena));
+
+  auto in_input = [&json](std::string_view str) {
+    return str.data() >= json.data() && str.data() + str.size() <= json.data() + json.size();
+  };
+  EXPECT_EQ("Alice", message.sender);
+  EXPECT_TRUE(in_input(message.sender));
+  ASSERT_EQ(3, message.tags.size());
+  EXPECT_EQ("a\"b", message.tags[0]);
+  EXPECT_EQ("", message.tags[1]);
+  EXPECT_EQ("\xe4\xbd\xa0\xf0\x9f\x98\x80\n", message.tags[2]);
+  EXPECT_TRUE(in_input(message.tags[0]));
+  EXPECT_TRUE(in_input(message.tags[2]));
+  ASSERT_EQ(2, message.path.size());
+  EXPECT_EQ((point_t{3, 4}), message.path[1]);
+  ASSERT_EQ(3, message.matrix.size());
+  EXPECT_EQ(2, message.matrix[0][1]);
+  EXPECT_EQ(0, message.matrix[1].size());
+  EXPECT_EQ(3, message.matrix[2][0]);
+  EXPECT_EQ("x\ty", message.owned);
+  EXPECT_EQ(7, message.id);
+  // Spans are allocated from the arena
+  auto* arena_begin = reinterpret_cast<const std::byte*>(storage);
+  auto* tags_begin = reinterpret_cast<const std::byte*>(message.tags.data());
+  EXPECT_TRUE(tags_begin >= arena_begin && tags_begin < arena_begin + sizeof(storage));
+  EXPECT_GE(arena.used(), 3 * sizeof(std::string_view) + 2 * sizeof(point_t) + 3 * sizeof(int));
+
+  // Insufficient arena storage
+  auto small_arena = rfl::json_arena{std::span{storage, 16}};
+  auto input = std::string{R"({"tags": ["a", "b", "c"]})"};
+  EXPECT_FALSE(rfl::deserialize_from_json_in_situ(message, input, small_arena));
+  input = R"({"tags": [], "sender": "Bob"})";
+  ASSERT_TRUE(rfl::deserialize_from_json_in_situ(message, input));
+  EXPECT_EQ("Bob", message.sender);
+  EXPECT_EQ(0, message.tags.size());
+  input = R"({"path": [{"x": 1, "y": 2}]})";
+  EXPECT_FALSE(rfl::deserialize_from_json_in_situ(message, input));
+
+  // Malformed input
+  for (auto malformed : {R"({"tags": ["a", ]})", R"({"tags": ["a" "b"]})", R"({"sender": "\x"})",
+                         R"({"matrix": [[1], [2, "3"]]})", R"({"sender": "abc)"}) {
+    input = malformed;
+    arena.reset();
+    EXPECT_FALSE(rfl::deserialize_from_json_in_situ(message, input, arena)) << malformed;
+  }
+
+  // Maps with string view keys are read from objects as serialize_to_json writes them
+  auto counts = std::map<std::string_view, int>{{"a\"b", 1}, {"c", 2}};
+  input = rfl::serialize_to_json(counts);
+  auto decoded_counts = std::map<std::string_view, int>{};
+  ASSERT_TRUE(rfl::deserialize_from_json_in_situ(decoded_counts, input));
+  EXPECT_EQ(counts, decoded_counts);
+
+  // Variants: rejected alternatives modify neither input nor arena
+  using views_t = std::variant<std::tuple<std::string_view, int>,
+                               std::tuple<std::string_view, std::string_view>>;
+  auto views = views_t{};
+  input = R"(["a\"b", "c\nd"])";
+  ASSERT_TRUE(rfl::deserialize_from_json_in_situ(views, input));
+  ASSERT_EQ(1, views.index());
+  EXPECT_EQ("a\"b", std::get<0>(std::get<1>(views)));
+  EXPECT_EQ("c\nd", std::get<1>(std::get<1>(views)));
+
+  using spans_t = std::variant<std::tuple<std::span<int>, std::string_view>,
+                               std::tuple<std::span<int>, int>>;
+  auto spans = spans_t{};
+  input = "[[1, 2], 3]";
+  arena.reset();
+  ASSERT_TRUE(rfl::deserialize_from_json_in_situ(spans, input, arena));
+  ASSERT_EQ(1, spans.index());
+  EXPECT_EQ(2, std::get<0>(std::get<1>(spans)).size());
+  EXPECT_EQ(3, std::get<1>(std::get<1>(spans)));
+  EXPECT_EQ(2 * sizeof(int), arena.used());
+}
+
+TEST(TypeOperationsDeserializeFromJson, ConstantEvaluation) {
+  constexpr auto point = rfl::deserialize_from_json<point_t>(R"({"y": 2, "x": 1})");
+  EXPECT_EQ_STATIC((point_t{.x = 1, .y = 2}), point);
+  EXPECT_EQ_STATIC(std::nullopt, rfl::deserialize_from_json<point_t>(R"({"x": 1.5})"));
+  EXPECT_EQ_STATIC(color_t::blue, rfl::deserialize_from_json<color_t>(R"("blue")"));
+  EXPECT_EQ_STATIC(0.25, rfl::deserialize_from_json<double>("2.5e-1"));
+  EXPECT_EQ_STATIC(-7, rfl::deserialize_from_json<std::optional<int>>(" -7 ").value());
+
+  // Results with strings and containers are converted with to_structural.
+  constexpr auto names =
+      rfl::deserialize_from_json_to_structural<std::vector<std::string>>(R"(["a", "b\u00e9"])");
+  static_assert(std::is_same_v<decltype(names), const rfl::meta_span<rfl::meta_string_view>>);
+  EXPECT_EQ_STATIC(2, names.size());
+  EXPECT_EQ_STATIC(std::string_view{"b\xC3\xA9"}, names[1]);
+
+  constexpr auto entries =
+      rfl::deserialize_from_json_to_structural<std::vector<std::tuple<std::string, int>>>(
+          R"([["x", 1], ["y", 2]])");
+  EXPECT_EQ_STATIC("y", get<0>(entries[1]));
+  constexpr auto entry_map = REFLECT_CPP26_STRING_KEY_FIXED_MAP(entries);
+  EXPECT_EQ_STATIC(2, entry_map.find("y").value());
+  EXPECT_FALSE_STATIC(entry_map.find("z").has_value());
+
+  // Raw bytes, e.g. from #embed
+  static constexpr unsigned char bytes[] = {'[', '1', ',', ' ', '2', ']'};
+  constexpr auto from_bytes = rfl::deserialize_from_json_to_structural<std::vector<int>>(bytes);
+  EXPECT_EQ_STATIC(2, from_bytes.size());
+  EXPECT_EQ_STATIC(2, from_bytes[1]);
+}
+
+TEST(TypeOperationsDeserializeFromJson, MemoryResources) {
+  constexpr auto json = R"({
+    "topic": "topic longer than the small string buffer",
+    "tags": ["tag longer than the small string buffer", "b"],
+    "values": {"key longer than the small string buffer": [1, 2, 3]},
+    "note": "note longer than the small string buffer",
+    "record": ["record longer than the small string buffer", 1],
+    "records": [["record longer than the small string buffer", 2]],
+    "id": 7
+  })";
+  auto upstream = counting_resource{};
+  auto fallback = counting_resource{};
+  auto* previous_default = std::pmr::set_default_resource(&fallback);
+
+  // Values with polymorphic allocators are rebound to the resource, including nested ones.
+  auto message = pmr_message_t{};
+  ASSERT_TRUE(rfl::deserialize_from_json(message, json, &upstream));
+  EXPECT_EQ("tag longer than the small string buffer", message.tags[0]);
+  EXPECT_EQ((std::pmr::vector<int>{1, 2, 3}), message.values.begin()->second);
+  EXPECT_EQ(&upstream, message.topic.get_allocator().resource());
+  EXPECT_EQ(&upstream, message.tags.get_allocator().resource());
+  EXPECT_EQ(&upstream, message.tags[0].get_allocator().resource());
+  EXPECT_EQ(&upstream, message.values.begin()->first.get_allocator().resource());
+  EXPECT_EQ(&upstream, message.values.begin()->second.get_allocator().resource());
+  EXPECT_EQ(&upstream, message.note->get_allocator().resource());
+  EXPECT_EQ(&upstream, std::get<0>(message.record).get_allocator().resource());
+  EXPECT_EQ(&upstream, std::get<0>(message.records[0]).get_allocator().resource());
+  EXPECT_EQ(2, std::get<1>(message.records[0]));
+  EXPECT_EQ(0, fallback.n_allocations);
+  EXPECT_LT(0, upstream.n_allocations);
+
+  // Decode context: allocations are served by the initial buffer, which is reset per message.
+  alignas(std::max_align_t) std::byte storage[4096];
+  auto context = rfl::json_decode_context{storage, &upstream};
+  auto n_upstream_allocations = upstream.n_allocations;
+  for (auto i = 0; i < 100; i++) {
+    auto decoded = rfl::deserialize_from_json<pmr_message_t>(json, context);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(7, decoded->id);
+    EXPECT_EQ(context.resource(), decoded->values.get_allocator().resource());
+    decoded.reset();
+    context.reset();
+  }
+  EXPECT_EQ(n_upstream_allocations, upstream.n_allocations);
+
+  // Large documents reuse the buffer of the structural index.
+  auto large_json = std::string{R"({"tags": [)"};
+  for (auto i = 0; i < 1000; i++) {
+    large_json += (i == 0) ? R"("x")" : R"(, "x")";
+  }
+  large_json += "]}";
+  for (auto i = 0; i < 2; i++) {
+    auto decoded = rfl::deserialize_from_json<pmr_message_t>(large_json, context);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(1000, decoded->tags.size());
+    decoded.reset();
+    context.reset();
+  }
+  EXPECT_FALSE(rfl::deserialize_from_json<pmr_message_t>(R"({"tags": [1]})", context));
+  EXPECT_EQ(0, fallback.n_allocations);
+  std::pmr::set_default_resource(previous_default);
+}
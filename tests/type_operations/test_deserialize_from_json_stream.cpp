@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <reflect_cpp26/type_operations/deserialize_from_json_stream.hpp>
+#include <reflect_cpp26/type_operations/serialize_to_json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+struct event_t {
+  std::string name;
+  int id;
+  std::vector<double> values;
+
+  bool operator==(const event_t&) const = default;
+};
+
+auto make_events(size_t n) {
+  auto res = std::vector<event_t>{};
+  for (auto i = 0zU; i < n; i++) {
+    auto name = "event \"" + std::to_string(i) + "\" \xe4\xbd\xa0\xf0\x9f\x98\x80";
+    res.push_back({.name = std::move(name), .id = static_cast<int>(i), .values = {i * 0.5, -1.0}});
+  }
+  return res;
+}
+
+auto make_ndjson(const std::vector<event_t>& events) {
+  auto res = std::string{};
+  for (const auto& event : events) {
+    res += rfl::serialize_to_json(event);
+    res += '\n';
+  }
+  return res;
+}
+
+TEST(TypeOperationsDeserializeFromJsonStream, ChunkSizes) {
+  auto events = make_events(20);
+  auto ndjson = make_ndjson(events);
+  // Chunks split values at every possible position, including within escape sequences and
+  // UTF-8 sequences.
+  for (auto chunk_size : {1zU, 2zU, 3zU, 7zU, 64zU, ndjson.size()}) {
+    auto actual = std::vector<event_t>{};
+    auto deserializer = rfl::json_stream_deserializer<event_t>{
+        [&actual](event_t&& event) { actual.push_back(std::move(event)); }};
+    for (auto i = 0zU; i < ndjson.size(); i += chunk_size) {
+      auto chunk = std::string_view{ndjson}.substr(i, chunk_size);
+      ASSERT_TRUE(deserializer.feed(chunk)) << "chunk_size = " << chunk_size;
+    }
+    EXPECT_TRUE(deserializer.finish());
+    EXPECT_EQ(events, actual) << "chunk_size = " << chunk_size;
+    EXPECT_EQ(20, deserializer.count());
+  }
+}
+
+TEST(TypeOperationsDeserializeFromJsonStream, EmitsOnClose) {
+  auto actual = std::vector<event_t>{};
+  auto deserializer = rfl::json_stream_deserializer<event_t>{
+      [&actual](event_t&& event) { actual.push_back(std::move(event)); }};
+  // Values are emitted as soon as they close, without waiting for delimiters.
+  ASSERT_TRUE(deserializer.feed(std::string_view{R"({"name": "a}", "id": 1)")));
+  EXPECT_EQ(0, actual.size());
+  ASSERT_TRUE(deserializer.feed(std::string_view{R"(}{"id": 2})")));
+  ASSERT_EQ(2, actual.size());
+  EXPECT_EQ("a}", actual[0].name);
+  EXPECT_EQ(2, actual[1].id);
+  EXPECT_TRUE(deserializer.finish());
+}
+
+TEST(TypeOperationsDeserializeFromJsonStream, Scalars) {
+  auto actual = std::vector<int>{};
+  auto deserializer =
+      rfl::json_stream_deserializer<int>{[&actual](int&& value) { actual.push_back(value); }};
+  ASSERT_TRUE(deserializer.feed(std::string_view{"1 -2\n3")));
+  EXPECT_EQ((std::vector{1, -2}), actual);
+  ASSERT_TRUE(deserializer.feed(std::string_view{"4"}));
+  EXPECT_EQ((std::vector{1, -2}), actual);
+  // A trailing number is completed by the end of stream only
+  EXPECT_TRUE(deserializer.finish());
+  EXPECT_EQ((std::vector{1, -2, 34}), actual);
+}
+
+TEST(TypeOperationsDeserializeFromJsonStream, Errors) {
+  auto count = 0;
+  auto deserializer = rfl::json_stream_deserializer<event_t>{[&count](event_t&&) { count += 1; }};
+  EXPECT_FALSE(deserializer.feed(std::string_view{R"({"id": 1} {"id": "x"} {"id": 3})")));
+  EXPECT_EQ(1, count);
+  // Failed state is kept until reset
+  EXPECT_FALSE(deserializer.feed(std::string_view{R"({"id": 4})")));
+  EXPECT_FALSE(deserializer.finish());
+  deserializer.reset();
+  ASSERT_TRUE(deserializer.feed(std::string_view{R"({"id": 5})")));
+  EXPECT_EQ(2, count);
+
+  // Incomplete value at the end of stream
+  ASSERT_TRUE(deserializer.feed(std::string_view{R"({"id": 6, "name": "abc)")));
+  EXPECT_FALSE(deserializer.finish());
+  deserializer.reset();
+  EXPECT_FALSE(deserializer.feed(std::string_view{"]"}));
+  deserializer.reset();
+  EXPECT_FALSE(deserializer.feed(std::string_view{"[1, 2]"}));
+  EXPECT_EQ(2, count);
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <cstdint>
+#include <optional>
+#include <reflect_cpp26/type_operations/json_document.hpp>
+#include <string>
+#include <vector>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+struct user_t {
+  int64_t id;
+  std::string name;
+};
+
+struct item_t {
+  std::string sku;
+  double price;
+};
+
+struct event_t {
+  user_t user;
+  std::vector<item_t> items;
+};
+
+constexpr auto event_json = R"({
+  "type": "purchase",
+  "payload": {"note": "skipped \"}]\" \\", "blob": [[1, 2], {"x": [3, {}]}], "flag": true},
+  "user": {"name": "Alice", "id": 42, "tags": ["a", "b"]},
+  "items": [{"sku": "A-1", "price": 9.5}, {"sku": "B-2", "price": 20}],
+  "user": {"id": 43}
+})";
+
+TEST(TypeOperationsJsonDocument, StringPaths) {
+  auto doc = rfl::json_document{event_json};
+  EXPECT_EQ(42, (rfl::get<"user.id", int64_t>(doc)));
+  EXPECT_EQ("Alice", (rfl::get<"user.name", std::string>(doc)));
+  EXPECT_EQ("b", (rfl::get<"user.tags.1", std::string>(doc)));
+  EXPECT_EQ(20.0, (rfl::get<"items.1.price", double>(doc)));
+  EXPECT_EQ("purchase", (rfl::get<"type", std::string>(doc)));
+  EXPECT_EQ(true, (rfl::get<"payload.flag", bool>(doc)));
+  EXPECT_EQ((std::vector<int>{1, 2}), (rfl::get<"payload.blob.0", std::vector<int>>(doc)));
+
+  auto user = rfl::get<"user", user_t>(doc);
+  ASSERT_TRUE(user.has_value());
+  EXPECT_EQ(42, user->id);
+  EXPECT_EQ("Alice", user->name);
+
+  // Absent paths or mismatched types
+  EXPECT_EQ(std::nullopt, (rfl::get<"user.email", std::string>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"user.tags.2", std::string>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"items.sku", std::string>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"type.x", int>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"user.name", int>(doc)));
+}
+
+TEST(TypeOperationsJsonDocument, SubDocuments) {
+  auto doc = rfl::json_document{event_json};
+  auto payload = rfl::get<"payload", rfl::json_document>(doc);
+  ASSERT_TRUE(payload.has_value());
+  EXPECT_EQ(R"({"note": "skipped \"}]\" \\", "blob": [[1, 2], {"x": [3, {}]}], "flag": true})",
+            payload->text());
+  EXPECT_EQ(3, (rfl::get<"blob.1.x.0", int>(*payload)));
+  EXPECT_EQ("1", (rfl::get<"blob.0.0", rfl::json_document>(*payload))->text());
+
+  auto whole = rfl::get<"", rfl::json_document>(doc);
+  ASSERT_TRUE(whole.has_value());
+  EXPECT_EQ('}', whole->text().back());
+}
+
+TEST(TypeOperationsJsonDocument, MemberPaths) {
+  auto doc = rfl::json_document{event_json};
+  EXPECT_EQ(42, (rfl::get<^^event_t::user, ^^user_t::id>(doc)));
+  EXPECT_EQ("Alice", (rfl::get<^^event_t::user, ^^user_t::name>(doc)));
+  auto items = rfl::get<^^event_t::items>(doc);
+  ASSERT_TRUE(items.has_value());
+  ASSERT_EQ(2, items->size());
+  EXPECT_EQ("B-2", (*items)[1].sku);
+}
+
+TEST(TypeOperationsJsonDocument, Malformed) {
+  // Only values along the path are inspected.
+  auto doc = rfl::json_document{R"({"skipped": [1, 2, {"a": }], "x": 1, "y": [})"};
+  EXPECT_EQ(1, (rfl::get<"x", int>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"y", std::vector<int>>(doc)));
+  EXPECT_EQ(std::nullopt, (rfl::get<"z", int>(doc)));
+
+  EXPECT_EQ(std::nullopt, (rfl::get<"a", int>(rfl::json_document{R"({"b": "unterminated)"})));
+  EXPECT_EQ(std::nullopt, (rfl::get<"a", int>(rfl::json_document{R"({"b": [1, 2)"})));
+  EXPECT_EQ(std::nullopt, (rfl::get<"a", int>(rfl::json_document{""})));
+}
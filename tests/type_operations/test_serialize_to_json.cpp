@@ -22,8 +22,12 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <cmath>
+#include <cstdio>
+#include <limits>
 #include <optional>
 #include <print>
+#include <sstream>
 #include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
 #include <reflect_cpp26/type_operations/serialize_to_json.hpp>
 #include <variant>
@@ -2391,3 +2395,313 @@ TEST(TypeOperationsSerializeToJson, InvalidUtf16SurrogatePairReplacement) {
       std::u16string_view{u"{\"data\":\"Valid\uFFFD\U00050000\uFFFDText\\n\"}"};
   EXPECT_EQ_STATIC(expected, rfl::serialize_to_json<char16_t>(make_s()));
 }
+
+TEST(TypeOperationsSerializeToJson, EnumJsonTokenTable) {
+  constexpr const auto& colors = rfl::impl::json::enum_json_token_table_v<char, color_t>;
+  EXPECT_EQ_STATIC(R"("red""green""blue")", std::string_view{colors.pool});
+  EXPECT_EQ_STATIC(R"("green")", colors.get(1));
+  EXPECT_EQ_STATIC("", colors.get(3));
+  EXPECT_EQ_STATIC("", colors.get(rfl::npos));
+
+  constexpr const auto& colors_u16 = rfl::impl::json::enum_json_token_table_v<char16_t, color_t>;
+  EXPECT_EQ_STATIC(uR"("blue")", colors_u16.get(2));
+
+  constexpr const auto& perms = rfl::impl::json::enum_flags_json_token_table_v<char, permissions_t>;
+  EXPECT_EQ_STATIC(R"("")", perms.get(0));
+  EXPECT_EQ_STATIC(R"("execute")", perms.get(4));
+  EXPECT_EQ_STATIC("", perms.get(8));
+
+  constexpr rfl::serialize_options opts{.enum_to_string = true, .halts_on_invalid_enum = true};
+  EXPECT_EQ_STATIC(std::nullopt, (rfl::serialize_to_json<char, opts>(static_cast<color_t>(3))));
+  constexpr rfl::serialize_options null_opts{.enum_to_string = true};
+  EXPECT_EQ_STATIC("[null,\"blue\"]",
+                   (rfl::serialize_to_json<char, null_opts>(
+                       std::array{static_cast<color_t>(-1), color_t::blue})));
+}
+
+TEST(TypeOperationsSerializeToJson, StreamToCallback) {
+  auto people = std::vector<nested_t>{};
+  for (auto i = 0; i < 2000; i++) {
+    people.push_back({.person = {.name = "person #" + std::to_string(i), .age = i % 100},
+                      .scores = {i, i * 2, i * 3}});
+  }
+  auto chunks = std::vector<std::string>{};
+  auto sink = [&chunks](std::string_view chunk) { chunks.emplace_back(chunk); };
+  ASSERT_TRUE(rfl::serialize_to_json(sink, people, {.buffer_size = 1}));
+
+  EXPECT_GT(chunks.size(), 1);
+  auto joined = std::string{};
+  for (const auto& chunk : chunks) {
+    EXPECT_LE(chunk.size(), rfl::json_stream_min_buffer_size);
+    joined += chunk;
+  }
+  EXPECT_EQ(rfl::serialize_to_json(people), joined);
+}
+
+TEST(TypeOperationsSerializeToJson, StreamLongStrings) {
+  // Multi-unit code points cross chunk boundaries at various offsets.
+  auto u8_value = std::vector<std::string>{};
+  auto u16_value = std::map<std::u16string, std::u16string>{};
+  for (auto i = 0; i < 4; i++) {
+    auto s = std::string(i, 'x');
+    auto s16 = std::u16string(i, u'x');
+    for (auto j = 0; j < 10000; j++) {
+      s += (j % 3 == 0) ? "\xe4\xbd\xa0" : (j % 3 == 1) ? "\xf0\x9f\x98\x80" : "\"\n";
+      s16 += (j % 2 == 0) ? u"\U0001F600" : u"\u4F60";
+    }
+    u8_value.push_back(std::move(s));
+    u16_value.emplace(s16, s16);
+  }
+  auto out = std::ostringstream{};
+  ASSERT_TRUE(rfl::serialize_to_json(out, u8_value, {.buffer_size = 0}));
+  EXPECT_EQ(rfl::serialize_to_json(u8_value), out.str());
+
+  auto out16 = std::u16string{};
+  auto sink16 = [&out16](std::u16string_view chunk) {
+    EXPECT_LE(chunk.size(), rfl::json_stream_min_buffer_size);
+    out16 += chunk;
+  };
+  constexpr auto opts = rfl::serialize_options{};
+  ASSERT_TRUE((rfl::serialize_to_json<opts, char16_t>(sink16, u16_value, 2)));
+  EXPECT_EQ(rfl::serialize_to_json<char16_t>(u16_value, 2), out16);
+}
+
+TEST(TypeOperationsSerializeToJson, StreamToFile) {
+  auto value = nested_t{.person = {.name = "Alice", .age = 30}, .scores = {95, 87, 92}};
+  auto* file = std::tmpfile();
+  ASSERT_NE(nullptr, file);
+  ASSERT_TRUE(rfl::serialize_to_json(file, value, 2));
+  std::rewind(file);
+  auto buffer = std::string(1024, '\0');
+  buffer.resize(std::fread(buffer.data(), 1, buffer.size(), file));
+  std::fclose(file);
+  EXPECT_EQ(rfl::serialize_to_json(value, 2), buffer);
+}
+
+TEST(TypeOperationsSerializeToJson, StreamFailures) {
+  auto value = std::vector<int>(10000, 42);
+  auto n_calls = 0;
+  auto failing_sink = [&n_calls](std::string_view) {
+    n_calls += 1;
+    return false;
+  };
+  EXPECT_FALSE(rfl::serialize_to_json(failing_sink, value));
+  EXPECT_EQ(1, n_calls);  // No more writes after the first failure
+
+  constexpr rfl::serialize_options opts{.enum_to_string = true, .halts_on_invalid_enum = true};
+  auto output = std::string{};
+  auto sink = [&output](std::string_view chunk) { output += chunk; };
+  auto colors = std::array{color_t::red, static_cast<color_t>(42)};
+  EXPECT_FALSE(rfl::serialize_to_json<opts>(sink, colors));
+  EXPECT_TRUE(rfl::serialize_to_json<opts>(sink, colors[0]));
+  EXPECT_EQ("\"red\"", output);
+}
+
+struct wide_t {
+  std::array<double, 100> a;
+  std::array<double, 100> b;
+  std::array<double, 100> c;
+};
+
+// Counts allocations of string builders.
+struct counting_allocator {
+  using value_type = char;
+  size_t* n_allocations;
+
+  auto allocate(size_t n) -> char* {
+    *n_allocations += 1;
+    return std::allocator<char>{}.allocate(n);
+  }
+
+  void deallocate(char* p, size_t n) {
+    std::allocator<char>{}.deallocate(p, n);
+  }
+};
+
+TEST(TypeOperationsSerializeToJson, StreamWideStructs) {
+  // Each member is bounded (about 3K characters), but the three together exceed the limit.
+  constexpr const auto& reservations =
+      rfl::impl::json::struct_json_reservations_v<rfl::serialize_options{}, char, wide_t>;
+  EXPECT_EQ_STATIC(1, reservations[0].count);
+  EXPECT_EQ_STATIC(1, reservations[1].count);
+  EXPECT_EQ_STATIC(1, reservations[2].count);
+
+  auto value = wide_t{};
+  for (auto i = 0; i < 100; i++) {
+    value.a[i] = -1.0 / (i + 3);
+    value.b[i] = 1e-300 / (i + 7);
+    value.c[i] = 1.0 / 3.0 + i;
+  }
+  auto n_allocations = 0zU;
+  auto output = std::string{};
+  auto flush = [](void* context, const char* data, size_t length) {
+    EXPECT_LE(length, rfl::json_stream_min_buffer_size);
+    static_cast<std::string*>(context)->append(data, length);
+  };
+  auto builder = rfl::basic_string_builder<char, counting_allocator>{
+      rfl::json_stream_min_buffer_size, counting_allocator{&n_allocations}};
+  builder.set_flush_handler(flush, &output);
+  for (auto i = 0; i < 4; i++) {
+    ASSERT_TRUE(rfl::serialize_to_json(builder, value));
+    ASSERT_TRUE(rfl::serialize_to_json(builder, value, 2));
+  }
+  builder.flush();
+  EXPECT_EQ(1, n_allocations);  // The buffer never grows
+  auto expected = rfl::serialize_to_json(value) + rfl::serialize_to_json(value, 2);
+  EXPECT_EQ(expected + expected + expected + expected, output);
+}
+
+struct deep_leaf_t {
+  int a;
+  bool b;
+  double c;
+};
+
+TEST(TypeOperationsSerializeToJson, StreamDeepIndentation) {
+  // Shared reservations of struct members and leaf ranges exceed the buffer size with indentation
+  // of thousands of characters, which are split then.
+  auto structs = std::vector<std::vector<std::vector<deep_leaf_t>>>{
+      {{{1, true, 0.5}, {2, false, -1.0}}}, {}};
+  auto ints = std::vector<std::vector<std::vector<int>>>{{{1, 2, 3}, {}}, {{4}}};
+  auto n_allocations = 0zU;
+  auto output = std::string{};
+  auto flush = [](void* context, const char* data, size_t length) {
+    static_cast<std::string*>(context)->append(data, length);
+  };
+  auto builder = rfl::basic_string_builder<char, counting_allocator>{
+      rfl::json_stream_min_buffer_size, counting_allocator{&n_allocations}};
+  builder.set_flush_handler(flush, &output);
+  ASSERT_TRUE(rfl::serialize_to_json(builder, structs, 1500));
+  ASSERT_TRUE(rfl::serialize_to_json(builder, ints, 1500, '\t'));
+  builder.flush();
+  EXPECT_EQ(1, n_allocations);  // The buffer never grows
+  EXPECT_EQ(rfl::serialize_to_json(structs, 1500) + rfl::serialize_to_json(ints, 1500, '\t'),
+            output);
+}
+
+struct scalar_run_t {
+  int a;
+  bool b;
+  std::string s;
+  color_t c;
+  const uint8_t d;
+};
+
+TEST(TypeOperationsSerializeToJson, StructKeyTable) {
+  constexpr const auto& keys = rfl::impl::json::struct_json_key_table_v<char, scalar_run_t>;
+  EXPECT_EQ_STATIC(R"({"a":)", keys.get(0));
+  EXPECT_EQ_STATIC(R"(,"s":)", keys.get(2));
+  constexpr const auto& indented_keys =
+      rfl::impl::json::struct_json_indented_key_table_v<char16_t, scalar_run_t>;
+  EXPECT_EQ_STATIC(uR"("d": )", indented_keys.get(4));
+
+  // Scalar members {a, b} and {c, d} share one reservation respectively.
+  constexpr const auto& reservations =
+      rfl::impl::json::struct_json_reservations_v<rfl::serialize_options{}, char, scalar_run_t>;
+  EXPECT_EQ_STATIC(26, reservations[0].size);  // 5 + 11 (int) + 5 + 5 (bool)
+  EXPECT_EQ_STATIC(2, reservations[0].count);
+  EXPECT_EQ_STATIC(0, reservations[1].count);
+  EXPECT_EQ_STATIC(5, reservations[2].size);
+  EXPECT_EQ_STATIC(25, reservations[3].size);  // 5 + 11 (int) + 5 + 4 (uint8_t)
+  EXPECT_EQ_STATIC(0, reservations[4].count);
+
+  constexpr rfl::serialize_options opts{.enum_to_string = true};
+  constexpr const auto& reservations_2 =
+      rfl::impl::json::struct_json_reservations_v<opts, char, scalar_run_t>;
+  EXPECT_EQ_STATIC(21, reservations_2[3].size);  // 5 + 7 ("green") + 5 + 4 (uint8_t)
+  EXPECT_EQ_STATIC(0, reservations_2[4].count);
+
+  constexpr auto make_value = []() constexpr -> scalar_run_t {
+    return {.a = -42, .b = false, .s = "x", .c = color_t::blue, .d = 255};
+  };
+  EXPECT_EQ_STATIC(R"({"a":-42,"b":false,"s":"x","c":2,"d":255})",
+                   rfl::serialize_to_json(make_value()));
+  EXPECT_EQ_STATIC(uR"({"a":-42,"b":false,"s":"x","c":"blue","d":255})",
+                   (rfl::serialize_to_json<char16_t, opts>(make_value())));
+  EXPECT_EQ_STATIC("{\n  \"a\": -42,\n  \"b\": false,\n  \"s\": \"x\",\n"
+                   "  \"c\": 2,\n  \"d\": 255\n}",
+                   rfl::serialize_to_json(make_value(), 2));
+}
+
+struct bounded_t {
+  int32_t x;
+  std::array<uint8_t, 3> rgb;
+  std::optional<bool> flag;
+  std::pair<int16_t, color_t> tag;
+};
+
+TEST(TypeOperationsSerializeToJson, StaticMaxLength) {
+  using rfl::impl::json::json_max_length_v;
+  constexpr auto opts = rfl::serialize_options{};
+  EXPECT_EQ_STATIC(5, (json_max_length_v<opts, char, bool>));
+  EXPECT_EQ_STATIC(32, (json_max_length_v<opts, char, double>));
+  EXPECT_EQ_STATIC(0, (json_max_length_v<opts, char, long double>));
+  EXPECT_EQ_STATIC(2, (json_max_length_v<opts, char, std::array<int, 0>>));
+  EXPECT_EQ_STATIC(11, (json_max_length_v<opts, char, std::variant<std::monostate, color_t>>));
+  // 1 + (5 + 11) + (7 + 16) + (8 + 5) + (7 + 20)
+  EXPECT_EQ_STATIC(80, (json_max_length_v<opts, char, bounded_t>));
+  // Unbounded or too long for a single reservation
+  EXPECT_EQ_STATIC(0, (json_max_length_v<opts, char, person_t>));
+  EXPECT_EQ_STATIC(0, (json_max_length_v<opts, char, std::vector<int>>));
+  EXPECT_EQ_STATIC(0, (json_max_length_v<opts, char, std::array<double, 1000>>));
+
+  constexpr auto str_opts = rfl::serialize_options{.char_to_string = true, .enum_to_string = true};
+  EXPECT_EQ_STATIC(8, (json_max_length_v<str_opts, char, char>));
+  EXPECT_EQ_STATIC(7, (json_max_length_v<str_opts, char, color_t>));  // "green"
+  EXPECT_EQ_STATIC(0, (json_max_length_v<str_opts, char, std::string>));
+}
+
+TEST(TypeOperationsSerializeToJson, BoundedValues) {
+  constexpr auto make_values = []() constexpr {
+    return std::vector<bounded_t>{
+        {.x = INT32_MIN, .rgb = {0, 128, 255}, .flag = std::nullopt, .tag = {-32768, color_t::red}},
+        {.x = INT32_MAX, .rgb = {}, .flag = false, .tag = {32767, static_cast<color_t>(-1)}},
+    };
+  };
+  EXPECT_EQ_STATIC(R"([{"x":-2147483648,"rgb":[0,128,255],"flag":null,"tag":[-32768,0]},)"
+                   R"({"x":2147483647,"rgb":[0,0,0],"flag":false,"tag":[32767,-1]}])",
+                   rfl::serialize_to_json(make_values()));
+
+  constexpr auto str_opts = rfl::serialize_options{.char_to_string = true, .enum_to_string = true};
+  EXPECT_EQ_STATIC(R"([["\"","\n"],["red",null]])",
+                   (rfl::serialize_to_json<char, str_opts>(
+                       std::tuple{std::pair{'"', '\n'}, std::array{color_t::red, color_t{-1}}})));
+
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  auto doubles = std::array{-2.2250738585072014e-308, -1.7976931348623157e308, nan, -inf};
+  EXPECT_EQ(R"([-2.2250738585072014e-308,-1.7976931348623157e+308,"NaN","-Infinity"])",
+            rfl::serialize_to_json(doubles));
+  auto floats = std::array{-1.1754944e-38f, std::numeric_limits<float>::infinity()};
+  EXPECT_EQ(R"([-1.1754944e-38,"Infinity"])", rfl::serialize_to_json(floats));
+
+  constexpr auto halts = rfl::serialize_options{.halts_on_non_finite_floating_point = true};
+  EXPECT_EQ(std::nullopt, (rfl::serialize_to_json<char, halts>(doubles)));
+  EXPECT_EQ("[1,0.5]", (rfl::serialize_to_json<char, halts>(std::array{1.0, 0.5})));
+}
+
+TEST(TypeOperationsSerializeToJson, ContiguousArithmeticRanges) {
+  auto integers = std::vector<int64_t>{INT64_MIN, INT64_MAX, 0};
+  auto expected = "[" + std::to_string(INT64_MIN) + "," + std::to_string(INT64_MAX) + ",0";
+  for (auto i = int64_t{1}; i < 5000; i++) {
+    integers.push_back(i % 2 == 0 ? i * i * i : -i * 7);
+    expected += "," + std::to_string(integers.back());
+  }
+  expected += "]";
+  EXPECT_EQ(expected, rfl::serialize_to_json(integers));
+
+  auto doubles = std::vector{0.1, -1e300, 5e-324, std::numeric_limits<double>::quiet_NaN()};
+  EXPECT_EQ(R"([0.1,-1e+300,5e-324,"NaN"])", rfl::serialize_to_json(doubles));
+  constexpr auto halts = rfl::serialize_options{.halts_on_non_finite_floating_point = true};
+  EXPECT_EQ(std::nullopt, (rfl::serialize_to_json<char, halts>(doubles)));
+
+  EXPECT_EQ_STATIC("[\n  1,\n  -2\n]", rfl::serialize_to_json(std::vector{1, -2}, 2));
+  EXPECT_EQ_STATIC("[\n]", rfl::serialize_to_json(std::vector<int>{}, 2));
+  EXPECT_EQ_STATIC("[]", rfl::serialize_to_json(std::vector<int>{}));
+  EXPECT_EQ_STATIC(u8"[-5,10]", rfl::serialize_to_json<char8_t>(std::vector{-5, 10}));
+  EXPECT_EQ_STATIC("[true,false]", rfl::serialize_to_json(std::array<bool, 2>{true, false}));
+
+  constexpr auto str_opts = rfl::serialize_options{.enum_to_string = true};
+  EXPECT_EQ_STATIC(R"(["green",null])", (rfl::serialize_to_json<char, str_opts>(std::vector{
+                                            color_t::green, static_cast<color_t>(5)})));
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <gmock/gmock-matchers.h>
+
+#include <reflect_cpp26/type_operations/serialize_to_json_parallel.hpp>
+#include <string>
+#include <vector>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+struct record_t {
+  std::string name;
+  int id;
+  std::vector<double> values;
+};
+
+enum class level_t {
+  low,
+  high,
+};
+
+auto make_records(size_t n) {
+  auto res = std::vector<record_t>{};
+  for (auto i = 0zU; i < n; i++) {
+    auto name = "record \"" + std::to_string(i) + "\"";
+    res.push_back({.name = std::move(name), .id = static_cast<int>(i), .values = {i * 0.5, -1.0}});
+  }
+  return res;
+}
+
+// Runs tasks in reverse order on the calling thread
+struct reverse_executor {
+  std::vector<size_t>* order;
+
+  void operator()(size_t n, const rfl::json_parallel_task& task) const {
+    for (auto i = n; i > 0; i--) {
+      order->push_back(i - 1);
+      task(i - 1);
+    }
+  }
+};
+
+TEST(TypeOperationsSerializeToJsonParallel, SameAsSequential) {
+  auto records = make_records(1000);
+  auto executor = rfl::json_thread_executor{.max_threads = 4};
+  constexpr auto options = rfl::json_parallel_options{.min_size = 1, .chunk_size = 7};
+
+  EXPECT_EQ(rfl::serialize_to_json(records),
+            rfl::serialize_to_json_parallel(executor, records, options));
+  EXPECT_EQ(rfl::serialize_to_json(records, 2),
+            rfl::serialize_to_json_parallel(executor, records, 2, ' ', options));
+  EXPECT_EQ(rfl::serialize_to_json<wchar_t>(records, 1, L'\t'),
+            rfl::serialize_to_json_parallel(executor, records, 1, L'\t', options));
+
+  // Leaf elements (handled with fast path in sequential serialization)
+  auto ints = std::vector<int>(10000);
+  for (auto i = 0; i < 10000; i++) {
+    ints[i] = i * (i % 2 == 0 ? 1 : -1);
+  }
+  EXPECT_EQ(rfl::serialize_to_json(ints), rfl::serialize_to_json_parallel(executor, ints));
+  EXPECT_EQ(rfl::serialize_to_json(ints, 4), rfl::serialize_to_json_parallel(executor, ints, 4));
+}
+
+TEST(TypeOperationsSerializeToJsonParallel, CustomExecutor) {
+  auto records = make_records(10);
+  auto order = std::vector<size_t>{};
+  auto executor = reverse_executor{.order = &order};
+  constexpr auto options = rfl::json_parallel_options{.min_size = 5, .chunk_size = 4};
+
+  EXPECT_EQ(rfl::serialize_to_json(records),
+            rfl::serialize_to_json_parallel(executor, records, options));
+  EXPECT_THAT(order, testing::ElementsAre(2, 1, 0));
+
+  // Smaller than min_size: executor is not used
+  order.clear();
+  records.resize(4);
+  EXPECT_EQ(rfl::serialize_to_json(records, 2),
+            rfl::serialize_to_json_parallel(executor, records, 2, ' ', options));
+  EXPECT_THAT(order, testing::IsEmpty());
+}
+
+TEST(TypeOperationsSerializeToJsonParallel, EmptyRange) {
+  auto executor = rfl::json_thread_executor{};
+  auto records = std::vector<record_t>{};
+  constexpr auto options = rfl::json_parallel_options{.min_size = 0};
+
+  EXPECT_EQ("[]", rfl::serialize_to_json_parallel(executor, records, options));
+  EXPECT_EQ("[\n]", rfl::serialize_to_json_parallel(executor, records, 2, ' ', options));
+}
+
+TEST(TypeOperationsSerializeToJsonParallel, Halts) {
+  constexpr rfl::serialize_options opts{.enum_to_string = true, .halts_on_invalid_enum = true};
+  constexpr auto options = rfl::json_parallel_options{.min_size = 1, .chunk_size = 16};
+  auto executor = rfl::json_thread_executor{.max_threads = 3};
+
+  auto levels = std::vector<level_t>(100, level_t::high);
+  auto res = rfl::serialize_to_json_parallel<char, opts>(executor, levels, options);
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(rfl::serialize_to_json<char, opts>(levels), res);
+
+  levels[50] = static_cast<level_t>(42);
+  EXPECT_EQ(std::nullopt, rfl::serialize_to_json_parallel<char, opts>(executor, levels, options));
+  EXPECT_EQ(std::nullopt,
+            rfl::serialize_to_json_parallel<char, opts>(executor, levels, 2, ' ', options));
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <reflect_cpp26/enum/enum_bitwise_operators.hpp>
+#include <reflect_cpp26/type_operations/validate_json.hpp>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+enum class level_t {
+  debug,
+  info,
+  warning,
+};
+
+enum class access_t : uint8_t {
+  read = 1,
+  write = 2,
+};
+REFLECT_CPP26_DEFINE_ENUM_BITWISE_BINARY_OPERATORS(access_t)
+template <>
+constexpr auto rfl::is_enum_flag_v<access_t> = true;
+
+struct endpoint_t {
+  std::string host;
+  uint16_t port;
+};
+
+struct request_t {
+  int32_t id;
+  level_t level;
+  access_t access;
+  std::optional<std::string> token;
+  std::vector<endpoint_t> endpoints;
+  std::map<std::string, double> weights;
+  std::variant<int8_t, std::string> tag;
+  std::tuple<bool, char16_t> extra;
+};
+
+constexpr auto request_json = R"({
+  "id": 42,
+  "level": "warning",
+  "access": "read|write",
+  "token": null,
+  "endpoints": [{"host": "a.example", "port": 443}, {"port": 80, "host": "b"}],
+  "weights": {"x": 0.5, "é": -1e3},
+  "tag": "big",
+  "extra": [true, "é"]
+})";
+
+// Validation agrees with deserialization.
+template <class T, rfl::deserialize_options Options = {}>
+void expect_validation(std::string_view json) {
+  auto expected = rfl::deserialize_from_json<T, Options>(json).has_value();
+  EXPECT_EQ(expected, (rfl::validate_json<T, Options>(json))) << "Input: " << json;
+}
+
+TEST(TypeOperationsValidateJson, ScalarsStatic) {
+  EXPECT_TRUE_STATIC(rfl::validate_json<int32_t>(" -2147483648 "));
+  EXPECT_FALSE_STATIC(rfl::validate_json<int32_t>("2147483648"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<uint8_t>("-1"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<int32_t>("1.0"));
+  EXPECT_TRUE_STATIC(rfl::validate_json<double>("1e308"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<double>("1e309"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<float>("1e39"));
+  EXPECT_TRUE_STATIC(rfl::validate_json<level_t>(R"("info")"));
+  EXPECT_TRUE_STATIC(rfl::validate_json<level_t>(R"("\u0069nfo")"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<level_t>(R"("INFO")"));
+  EXPECT_TRUE_STATIC(rfl::validate_json<access_t>(R"("write|read")"));
+  EXPECT_FALSE_STATIC(rfl::validate_json<access_t>(R"("read|exec")"));
+}
+
+TEST(TypeOperationsValidateJson, Scalars) {
+  for (auto json : {"0", "-0", "127", "128", "-129", "01", "1e2", "\"a\"", "true", "null", ""}) {
+    expect_validation<int8_t>(json);
+  }
+  for (auto json : {"1.5", "-1e-400", "1e400", "1.", ".5", "-", "NaN", "1e5 x", R"("NaN")",
+                    R"("Infinity")", R"("-Infinity")", R"("inf")"}) {
+    expect_validation<double>(json);
+    expect_validation<float>(json);
+  }
+  for (auto json : {R"("a")", R"("ab")", R"("é")", R"("😀")", "65", "70000"}) {
+    expect_validation<char>(json);
+    expect_validation<char16_t>(json);
+    expect_validation<char32_t>(json);
+  }
+  for (auto json : {R"("debug")", R"("Debug")", "1", "7", R"("\u0064ebug")", R"("debug)"}) {
+    expect_validation<level_t>(json);
+    expect_validation<level_t, rfl::deserialize_options{.rejects_invalid_enum = true}>(json);
+  }
+  for (auto json : {R"("read")", R"("read|write")", R"("read|")", "3", "4", R"("r\u0065ad")"}) {
+    expect_validation<access_t>(json);
+    expect_validation<access_t, rfl::deserialize_options{.rejects_invalid_enum = true}>(json);
+  }
+  for (auto json : {R"("abc")", R"("a\"b")", R"("\x")", R"("\uD83D")", "\"\xff\"", "\"\t\""}) {
+    expect_validation<std::string>(json);
+    expect_validation<std::u16string>(json);
+  }
+}
+
+TEST(TypeOperationsValidateJson, Structs) {
+  EXPECT_TRUE(rfl::validate_json<request_t>(request_json));
+  expect_validation<request_t>(request_json);
+
+  auto test_all = [](std::string_view json) {
+    expect_validation<request_t>(json);
+    expect_validation<request_t, rfl::deserialize_options{.ignores_unknown_keys = false}>(json);
+    expect_validation<request_t, rfl::deserialize_options{.requires_all_members = true}>(json);
+  };
+  test_all(request_json);
+  test_all(R"({})");
+  test_all(R"({"id": 1, "unknown": {"nested": [1, 2, {"x": null}]}})");
+  test_all(R"({"\u0069d": 1})");                // Escaped key
+  test_all(R"({"\u0069d_too_long_key": 1})");  // Escaped key longer than any member name
+  test_all(R"({"id": 1, "id": 2})");
+  test_all(R"({"id": 2147483648})");
+  test_all(R"({"endpoints": [{"host": "a", "port": 65536}]})");
+  test_all(R"({"level": "fatal"})");
+  test_all(R"({"access": "read|delete"})");
+  test_all(R"({"tag": 127})");
+  test_all(R"({"tag": 128})");
+  test_all(R"({"extra": [true]})");
+  test_all(R"({"extra": [false, "ab"]})");
+  test_all(R"({"weights": {"x": "y"}})");
+  test_all(R"({"id": 1,})");
+  test_all(R"({"id": 1} {})");
+  test_all(R"({"id": 1)");
+  test_all(R"([1, 2])");
+}
+
+TEST(TypeOperationsValidateJson, Truncations) {
+  // Every proper prefix of a valid document is rejected.
+  auto json = std::string_view{request_json};
+  for (auto n = 0zU; n < json.size(); n++) {
+    EXPECT_FALSE(rfl::validate_json<request_t>(json.substr(0, n))) << json.substr(0, n);
+  }
+}
+
+TEST(TypeOperationsValidateJson, Containers) {
+  // Elements are validated without being stored, including nested containers.
+  using nested_t = std::vector<std::vector<std::string>>;
+  for (auto json : {R"([])", R"([[], ["a", "a long string beyond small buffers"]])",
+                    R"([["a"], [1]])", R"([["a"],])", R"([[null]])"}) {
+    expect_validation<nested_t>(json);
+  }
+  using int_map_t = std::map<int32_t, std::vector<level_t>>;
+  for (auto json : {R"([[1, ["info"]], [2, []]])", R"([[1, ["fatal"]]])", R"([[1]])",
+                    R"({"1": []})"}) {
+    expect_validation<int_map_t>(json);
+  }
+}
@@ -25,6 +25,7 @@
 #include <map>
 #include <reflect_cpp26/type_traits/serializable_types.hpp>
 #include <set>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -444,4 +445,93 @@ TEST(TypeTraits, SerializableNameInheritance) {
   static_assert(rfl::serializable<C1>);
   static_assert(NOT rfl::serializable<C2>);  // Name duplication
   static_assert(NOT rfl::serializable<D>);   // Inheritance
-}
\ No newline at end of file
+}
+// Struct with const member (serializable, but not deserializable)
+struct struct_with_const_member_t {
+  const int x;
+  double y;
+};
+
+// Struct without default constructor
+struct struct_without_default_ctor_t {
+  int x;
+
+  explicit struct_without_default_ctor_t(int x) : x(x) {}
+};
+
+TEST(TypeTraits, Deserializable) {
+  // ---- Owning or fillable types: ✔️ ----
+  static_assert(rfl::deserializable<std::monostate>);
+  static_assert(rfl::deserializable<int>);
+  static_assert(rfl::deserializable<double>);
+  static_assert(rfl::deserializable<bool>);
+  static_assert(rfl::deserializable<char16_t>);
+  static_assert(rfl::deserializable<color_t>);
+  static_assert(rfl::deserializable<std::string>);
+  static_assert(rfl::deserializable<std::u32string>);
+  static_assert(rfl::deserializable<int[4]>);
+  static_assert(rfl::deserializable<std::vector<int>>);
+  static_assert(rfl::deserializable<std::vector<bool>>);
+  static_assert(rfl::deserializable<std::deque<std::string>>);
+  static_assert(rfl::deserializable<std::list<serializable_struct_t>>);
+  static_assert(rfl::deserializable<std::set<int>>);
+  static_assert(rfl::deserializable<std::unordered_set<std::string>>);
+  static_assert(rfl::deserializable<std::map<std::string, serializable_struct_t>>);
+  static_assert(rfl::deserializable<std::map<int, std::vector<int>>>);
+  static_assert(rfl::deserializable<std::unordered_map<std::string, std::optional<int>>>);
+  static_assert(rfl::deserializable<std::array<double, 4>>);
+  static_assert(rfl::deserializable<std::pair<int, std::string>>);
+  static_assert(rfl::deserializable<std::tuple<>>);
+  static_assert(rfl::deserializable<std::optional<std::variant<int, std::string>>>);
+  static_assert(rfl::deserializable<foo_t>);
+  static_assert(rfl::deserializable<nested_serializable_struct_t>);
+  static_assert(rfl::deserializable<child_t>);
+
+  // ---- Non-owning, constant or non-default-constructible types: ❌ ----
+  static_assert(rfl::serializable<std::string_view>);
+  static_assert(NOT rfl::deserializable<std::string_view>);
+  static_assert(NOT rfl::deserializable<const char*>);
+  static_assert(NOT rfl::deserializable<char[8]>);
+  static_assert(NOT rfl::deserializable<std::vector<char>>);
+  static_assert(NOT rfl::deserializable<const int>);
+  static_assert(NOT rfl::deserializable<int[]>);
+  static_assert(NOT rfl::deserializable<std::span<int>>);
+  static_assert(NOT rfl::deserializable<std::vector<std::string_view>>);
+  static_assert(NOT rfl::deserializable<std::pair<const int, int>>);
+  static_assert(rfl::serializable<struct_with_const_member_t>);
+  static_assert(NOT rfl::deserializable<struct_with_const_member_t>);
+  static_assert(NOT rfl::deserializable<struct_without_default_ctor_t>);
+  static_assert(NOT rfl::deserializable<std::vector<struct_without_default_ctor_t>>);
+  static_assert(NOT rfl::deserializable<struct_with_pointer_t>);
+  static_assert(NOT rfl::deserializable<inheritance::C2>);  // Name duplication
+  static_assert(NOT rfl::deserializable<int&>);
+}
+
+struct in_situ_struct_t {
+  std::string_view name;
+  std::span<const int> values;
+  std::span<std::span<std::string_view>> nested;
+  std::string owned;
+};
+
+TEST(TypeTraits, DeserializableInSitu) {
+  // ---- Deserializable types, views into the input and spans from the arena: ✔️ ----
+  static_assert(rfl::deserializable_in_situ<int>);
+  static_assert(rfl::deserializable_in_situ<std::string>);
+  static_assert(rfl::deserializable_in_situ<nested_serializable_struct_t>);
+  static_assert(rfl::deserializable_in_situ<std::string_view>);
+  static_assert(rfl::deserializable_in_situ<std::span<int>>);
+  static_assert(rfl::deserializable_in_situ<std::span<const std::string_view>>);
+  static_assert(rfl::deserializable_in_situ<std::vector<std::string_view>>);
+  static_assert(rfl::deserializable_in_situ<std::optional<std::string_view>>);
+  static_assert(rfl::deserializable_in_situ<in_situ_struct_t>);
+  static_assert(NOT rfl::deserializable<in_situ_struct_t>);
+
+  // ---- Views of other character types, fixed extents or non-trivial elements: ❌ ----
+  static_assert(NOT rfl::deserializable_in_situ<std::u16string_view>);
+  static_assert(NOT rfl::deserializable_in_situ<const char*>);
+  static_assert(NOT rfl::deserializable_in_situ<std::span<int, 2>>);
+  static_assert(NOT rfl::deserializable_in_situ<std::span<std::string>>);
+  static_assert(NOT rfl::deserializable_in_situ<std::span<const char>>);
+  static_assert(NOT rfl::deserializable_in_situ<const std::string_view>);
+}
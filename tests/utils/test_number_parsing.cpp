@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2026 NoqtaBeda (noqtabeda@163.com)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ **/
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <reflect_cpp26/utils/number_parsing.hpp>
+#include <string>
+#include <string_view>
+
+#include "tests/test_options.hpp"
+
+namespace rfl = reflect_cpp26;
+
+template <class T>
+constexpr auto parse_integer_or(std::string_view text, T fallback) -> T {
+  auto value = fallback;
+  auto [ptr, ec] = rfl::parse_integer(text.data(), text.data() + text.size(), value);
+  return (ec == std::errc{} && ptr == text.data() + text.size()) ? value : fallback;
+}
+
+template <class T>
+constexpr auto parse_floating_point_or(std::string_view text, T fallback) -> T {
+  auto value = fallback;
+  auto [ptr, ec] = rfl::parse_floating_point(text.data(), text.data() + text.size(), value);
+  return (ec == std::errc{} && ptr == text.data() + text.size()) ? value : fallback;
+}
+
+TEST(UtilsNumberParsing, IntegersStatic) {
+  EXPECT_EQ_STATIC(0, parse_integer_or<int32_t>("0", -1));
+  EXPECT_EQ_STATIC(12345678, parse_integer_or<int32_t>("12345678", -1));
+  EXPECT_EQ_STATIC(-2147483648, parse_integer_or<int32_t>("-2147483648", -1));
+  EXPECT_EQ_STATIC(-1, parse_integer_or<int32_t>("2147483648", -1));
+  EXPECT_EQ_STATIC(UINT64_MAX, parse_integer_or<uint64_t>("18446744073709551615", 0));
+  EXPECT_EQ_STATIC(0, parse_integer_or<uint64_t>("18446744073709551616", 0));
+  EXPECT_EQ_STATIC(0, parse_integer_or<uint64_t>("-1", 0));
+  EXPECT_EQ_STATIC(INT64_MIN, parse_integer_or<int64_t>("-9223372036854775808", 0));
+  EXPECT_EQ_STATIC(255, parse_integer_or<uint8_t>("255", 0));
+  EXPECT_EQ_STATIC(0, parse_integer_or<uint8_t>("256", 0));
+}
+
+TEST(UtilsNumberParsing, IntegerResults) {
+  auto test = [](std::string_view text, std::errc expected_ec, size_t expected_length) {
+    auto value = int32_t{42};
+    auto [ptr, ec] = rfl::parse_integer(text.data(), text.data() + text.size(), value);
+    EXPECT_EQ(expected_ec, ec) << "Input: " << text;
+    EXPECT_EQ(expected_length, ptr - text.data()) << "Input: " << text;
+  };
+  test("123456789012", std::errc::result_out_of_range, 12);
+  test("123456789012345678901234", std::errc::result_out_of_range, 24);
+  test("-", std::errc::invalid_argument, 0);
+  test("+1", std::errc::invalid_argument, 0);
+  test("abc", std::errc::invalid_argument, 0);
+  test("", std::errc::invalid_argument, 0);
+  // JSON grammar: no leading zeros
+  test("0123", std::errc{}, 1);
+  test("-0", std::errc{}, 2);
+  test("12.5", std::errc{}, 2);
+  test("1234567890123456789012345", std::errc::result_out_of_range, 25);
+}
+
+TEST(UtilsNumberParsing, FloatingPointsStatic) {
+  EXPECT_EQ_STATIC(1.5, parse_floating_point_or("1.5", 0.0));
+  EXPECT_EQ_STATIC(-0.001, parse_floating_point_or("-1e-3", 0.0));
+  EXPECT_EQ_STATIC(1e22, parse_floating_point_or("1E+22", 0.0));
+  EXPECT_EQ_STATIC(1e23, parse_floating_point_or("1e23", 0.0));
+  EXPECT_EQ_STATIC(0.1f, parse_floating_point_or("0.1", 0.0f));
+  EXPECT_EQ_STATIC(2.2250738585072014e-308,
+                   parse_floating_point_or("2.2250738585072014e-308", 0.0));
+  EXPECT_EQ_STATIC(4.9406564584124654e-324,
+                   parse_floating_point_or("4.9406564584124654e-324", 0.0));
+  EXPECT_EQ_STATIC(1.7976931348623157e308,
+                   parse_floating_point_or("1.7976931348623157e308", 0.0));
+  EXPECT_EQ_STATIC(0.0, parse_floating_point_or("1e400", 0.0));
+  EXPECT_EQ_STATIC(0.0, parse_floating_point_or("1e-400", 0.0));
+  // More than 19 significant digits
+  EXPECT_EQ_STATIC(3.141592653589793,
+                   parse_floating_point_or("3.14159265358979323846264338327950288", 0.0));
+  EXPECT_EQ_STATIC(
+      1e-10, parse_floating_point_or("0.00000000010000000000000000000000000000", 0.0));
+}
+
+TEST(UtilsNumberParsing, FloatingPointResults) {
+  auto test = [](std::string_view text, std::errc expected_ec, size_t expected_length) {
+    auto value = 42.0;
+    auto [ptr, ec] = rfl::parse_floating_point(text.data(), text.data() + text.size(), value);
+    EXPECT_EQ(expected_ec, ec) << "Input: " << text;
+    EXPECT_EQ(expected_length, ptr - text.data()) << "Input: " << text;
+  };
+  test("1.", std::errc{}, 1);
+  test("1e", std::errc{}, 1);
+  test("1e+", std::errc{}, 1);
+  test(".5", std::errc::invalid_argument, 0);
+  test("-", std::errc::invalid_argument, 0);
+  test("inf", std::errc::invalid_argument, 0);
+  test("nan", std::errc::invalid_argument, 0);
+  test("-1e999", std::errc::result_out_of_range, 6);
+  test("1e-999", std::errc::result_out_of_range, 6);
+  test("-0.0e-999", std::errc{}, 9);
+}
+
+TEST(UtilsNumberParsing, HalfwayCases) {
+  // 2^53 + 1 is halfway between 2^53 and 2^53 + 2, which rounds to even.
+  EXPECT_EQ(9007199254740992.0, parse_floating_point_or("9007199254740993", 0.0));
+  EXPECT_EQ(9007199254740996.0, parse_floating_point_or("9007199254740995", 0.0));
+  // Slightly above halfway: requires all the digits.
+  EXPECT_EQ(9007199254740994.0,
+            parse_floating_point_or("9007199254740993.0000000000000000001", 0.0));
+  EXPECT_EQ(9007199254740992.0,
+            parse_floating_point_or("9007199254740993.0000000000000000000", 0.0));
+  EXPECT_EQ(16777216.0f, parse_floating_point_or("16777217", 0.0f));
+  EXPECT_EQ(16777218.0f, parse_floating_point_or("16777217.00000000000000000001", 0.0f));
+}
+
+TEST(UtilsNumberParsing, RoundTrip) {
+  auto rng = std::mt19937_64{42};
+  char buffer[64];
+  for (auto i = 0; i < 100'000; i++) {
+    auto d = std::bit_cast<double>(rng());
+    if (!std::isfinite(d)) {
+      continue;
+    }
+    auto* end = std::to_chars(buffer, buffer + sizeof(buffer), d).ptr;
+    auto parsed = 0.0;
+    auto [ptr, ec] = rfl::parse_floating_point(buffer, end, parsed);
+    ASSERT_EQ(std::errc{}, ec) << std::string_view{buffer, end};
+    ASSERT_EQ(end, ptr) << std::string_view{buffer, end};
+    ASSERT_EQ(std::bit_cast<uint64_t>(d), std::bit_cast<uint64_t>(parsed))
+        << std::string_view{buffer, end};
+
+    auto f = std::bit_cast<float>(static_cast<uint32_t>(rng()));
+    if (!std::isfinite(f)) {
+      continue;
+    }
+    end = std::to_chars(buffer, buffer + sizeof(buffer), f, std::chars_format::scientific, 12).ptr;
+    auto expected = 0.0f;
+    std::from_chars(buffer, end, expected);
+    auto parsed_f = 0.0f;
+    auto [ptr_f, ec_f] = rfl::parse_floating_point(buffer, end, parsed_f);
+    ASSERT_EQ(std::errc{}, ec_f) << std::string_view{buffer, end};
+    ASSERT_EQ(end, ptr_f) << std::string_view{buffer, end};
+    ASSERT_EQ(std::bit_cast<uint32_t>(expected), std::bit_cast<uint32_t>(parsed_f))
+        << std::string_view{buffer, end};
+  }
+}
+
+TEST(UtilsNumberParsing, Integers) {
+  auto rng = std::mt19937_64{42};
+  char buffer[32];
+  for (auto i = 0; i < 100'000; i++) {
+    auto v = static_cast<int64_t>(rng()) >> (rng() % 64);
+    auto* end = std::to_chars(buffer, buffer + sizeof(buffer), v).ptr;
+    auto parsed = int64_t{};
+    auto [ptr, ec] = rfl::parse_integer(buffer, end, parsed);
+    ASSERT_EQ(std::errc{}, ec) << std::string_view{buffer, end};
+    ASSERT_EQ(end, ptr);
+    ASSERT_EQ(v, parsed);
+
+    auto parsed_32 = int32_t{};
+    auto [ptr_32, ec_32] = rfl::parse_integer(buffer, end, parsed_32);
+    auto in_range = v >= INT32_MIN && v <= INT32_MAX;
+    ASSERT_EQ(in_range ? std::errc{} : std::errc::result_out_of_range, ec_32);
+    if (in_range) {
+      ASSERT_EQ(v, parsed_32);
+    }
+  }
+}
@@ -22,6 +22,7 @@
 
 #include <limits>
 #include <reflect_cpp26/utils/string_builder.hpp>
+#include <string>
 
 #include "tests/test_options.hpp"
 
@@ -259,6 +260,34 @@ TEST(UtilsStringBuilder, AppendIntegerInt64) {
   EXPECT_EQ(builder.strview(), "9223372036854775807");
 }
 
+TEST(UtilsStringBuilder, AppendIntegerDigitCounts) {
+  static_assert(rfl::impl::count_decimal_digits(0) == 1);
+  static_assert(rfl::impl::count_decimal_digits(9) == 1);
+  static_assert(rfl::impl::count_decimal_digits(10) == 2);
+  static_assert(rfl::impl::count_decimal_digits(UINT64_MAX) == 20);
+
+  rfl::string_builder builder;
+  auto expected = std::string{};
+  for (auto p = uint64_t{1}; p <= UINT64_MAX / 10; p *= 10) {
+    for (auto v : {p - 1, p, p + 1}) {
+      builder.append_integer(v).append_char(',');
+      builder.append_integer(-static_cast<int64_t>(v)).append_char(',');
+      expected += std::to_string(v) + ',' + std::to_string(-static_cast<int64_t>(v)) + ',';
+    }
+  }
+  builder.append_integer(INT64_MIN).append_char(',').append_integer(UINT64_MAX);
+  builder.append_char(',').append_integer(int8_t{-128}).append_char(',').append_integer(INT32_MIN);
+  expected += "-9223372036854775808,18446744073709551615,-128,-2147483648";
+  EXPECT_EQ(builder.strview(), expected);
+
+  constexpr auto make_u16 = []() constexpr {
+    rfl::u16string_builder builder;
+    builder.append_integer(-1234567890).append_char(u' ').append_integer(uint8_t{255});
+    return builder.str();
+  };
+  EXPECT_EQ_STATIC(u"-1234567890 255", make_u16());
+}
+
 TEST(UtilsStringBuilder, AppendFloatingPointFloat) {
   rfl::string_builder builder;
   builder.append_floating_point(3.14f);
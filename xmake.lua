@@ -73,6 +73,7 @@ meta_test_cases = {
   "utils/test_ctype",
   "utils/test_identifier_naming",
   "utils/test_meta_tuple",
+  "utils/test_number_parsing",
   "utils/test_ptr_variant",
   "utils/test_string_builder",
   "utils/test_string_encoding",
@@ -90,10 +91,12 @@ meta_test_cases = {
   "type_traits/class_types/test_flattened_nsdm",
   -- Enum
   "enum/impl/test_enum_flags_category",
+  "enum/test_enum_bitset",
   "enum/test_enum_bitwise_operators",
   "enum/test_enum_cast_from_integer",
   "enum/test_enum_cast_from_string",
   "enum/test_enum_cast_from_string_ci",
+  "enum/test_enum_cast_many",
   "enum/test_enum_comparison_operators",
   "enum/test_enum_contains_integer",
   "enum/test_enum_contains_string",
@@ -112,9 +115,11 @@ meta_test_cases = {
   "enum/test_enum_index",
   "enum/test_enum_json_static",
   "enum/test_enum_json",
+  "enum/test_enum_map",
   "enum/test_enum_meta_entries",
   "enum/test_enum_name",
   "enum/test_enum_names",
+  "enum/test_enum_names_to",
   "enum/test_enum_switch",
   "enum/test_enum_type_name",
   "enum/test_enum_unique_count",
@@ -172,9 +177,15 @@ meta_test_cases = {
   -- "lookup/namespace_member/string_key/test_references",
   -- "lookup/namespace_member/string_key/test_templates",
   -- Type Operations
+  "type_operations/test_class_schema_hash",
+  "type_operations/test_deserialize_from_json",
+  "type_operations/test_deserialize_from_json_stream",
   "type_operations/test_dump_to_json_like",
+  "type_operations/test_json_document",
   "type_operations/test_serialize_to_json",
+  "type_operations/test_serialize_to_json_parallel",
   "type_operations/test_to_structural",
+  "type_operations/test_validate_json",
 }
 
 for i, path in ipairs(meta_test_cases) do